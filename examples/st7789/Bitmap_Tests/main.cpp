@@ -184,8 +184,8 @@ void Test302(void)
 	delayMilliSecRVL(TEST_DELAY5);
 }
 
-// bitmap 24 colour , All file format = Windows BITMAPINFOHEADER offset 54
-// bitmap are 220 by 240 
+// bitmap 24 colour , Windows BITMAPINFOHEADER
+// bitmap is 220 by 240, streamed from the file by the library
 void Test303(void)
 {
 	std::cout << "Test 303: 24 bit color image bitmaps from the file system 220 X 240" << std::endl;
@@ -195,53 +195,21 @@ void Test303(void)
 	myTFT.writeCharString(35, 10, teststr1);
 	delayMilliSecRVL(TEST_DELAY1);
 
-	FILE *pFile ;
-	size_t pixelSize = 3; // 24 bit 3 bytes per pixel
-	uint8_t FileHeaderOffset = 54;
-	uint8_t NumberOfFiles  = 1;
-	uint8_t* bmpBuffer = nullptr;
-	bmpBuffer = (uint8_t*)malloc((220 * 240) * pixelSize);
-	if (bmpBuffer == nullptr)
-	{
-		std::cout << "Error Test 303 : MALLOC could not assign memory " << std::endl;
+	if(myTFT.drawBitmapFile(20, 0, "bitmap/bitmap24images/24pic7_220X240.bmp") != rvlDisplay_Success)
+	{// Check for success 0x00
+		std::cout << "Warning an Error occurred in drawBitmapFile" << std::endl;
 		return;
 	}
-	for (uint8_t i = 0 ; i < NumberOfFiles ; i++)
-	{
-		switch (i) // select file
-		{
-			case 0: pFile = fopen("bitmap/bitmap24images/24pic7_220X240.bmp", "r"); break;
-		}
-
-		if (pFile == nullptr)  // Check file exists
-		{
-			std::cout << "Error Test 303: File does not exist" << std::endl;
-			free(bmpBuffer);
-			return;
-		}
-
-		fseek(pFile, FileHeaderOffset, 0); // Put file in Buffer
-		fread(bmpBuffer, pixelSize, 220 * 240, pFile);
-		fclose(pFile);
-
-		if(myTFT.drawBitmap24(20, 0, bmpBuffer,220,240) != rvlDisplay_Success)
-		{// Check for success 0x00
-			std::cout << "Warning an Error occurred in drawBitmap24" << std::endl;
-			free(bmpBuffer);
-			return;
-		}
-		delayMilliSecRVL(TEST_DELAY5);
-	}
-	free(bmpBuffer);  // Free Up Buffer
+	delayMilliSecRVL(TEST_DELAY5);
 }
 
 // test function for 16 bit color bitmaps made in GIMP (RGB 565 16 bit color)
 // 3 files
-// File 1 16pic1.bmp BITMAPV5HEADER offset 132
+// File 1 16pic1.bmp BITMAPV5HEADER
 // Color space information written
 // File 2&3 16pic2.bmp & 16pic3.bmp
-// OS/2 OS22XBITMAPHEADER (BITMAPINFOHEADER2) offset 72
-// NO color space information written
+// BITMAPV3INFOHEADER, NO color space information written
+// The header size and pixel data offset are read from each file.
 // All bitmaps are 128 by 128.
 void Test304(void)
 {
@@ -251,113 +219,46 @@ void Test304(void)
 	myTFT.writeCharString(35, 10, teststr1);
 	delayMilliSecRVL(TEST_DELAY2);
 
-	FILE *pFile ;
-	size_t pixelSize = 2; // 16 bit 2 bytes per pixel
-	uint8_t NumberOfFiles  = 3;
-	uint8_t offsetBMPHeader = 0;
-	uint8_t offsetNoColSpace = 72;
-	uint8_t offsetColSpace = 132;
-	uint8_t bitmapWidth = 128;
-	uint8_t bitmapHeight = 128;
-	uint8_t* bmpBuffer1 = nullptr;
-	bmpBuffer1 = (uint8_t*)malloc((bitmapWidth * bitmapHeight) * pixelSize);
-
-	if (bmpBuffer1 == nullptr)
+	const char* fileNames[] = {
+		"bitmap/bitmap16images/16pic1.bmp",
+		"bitmap/bitmap16images/16pic2.bmp",
+		"bitmap/bitmap16images/16pic3.bmp"
+	};
+	bmpReader bmp;
+	for (const char* fileName : fileNames)
 	{
-		std::cout << "Error Test 304 : MALLOC could not assign memory " << std::endl;
-		return;
-	}
-
-	for (uint8_t i = 0 ; i < NumberOfFiles ; i++)
-	{
-		switch (i) // select file
-		{
-			case 0:
-				pFile = fopen("bitmap/bitmap16images/16pic1.bmp", "r");
-				offsetBMPHeader = offsetColSpace ;
-			break;
-			case 1: pFile = fopen("bitmap/bitmap16images/16pic2.bmp", "r"); 
-				offsetBMPHeader = offsetNoColSpace;
-			break;
-			case 2: pFile = fopen("bitmap/bitmap16images/16pic3.bmp", "r"); 
-				offsetBMPHeader = offsetNoColSpace;
-			break;
-		}
-		if (pFile == nullptr)
-		{
-			std::cout << "Error Test 404 : File does not exist" << std::endl;
-			free(bmpBuffer1);
+		if (bmp.open(fileName) != rvlDisplay_Success)
 			return;
-		}
-		fseek(pFile, offsetBMPHeader, 0);
-		fread(bmpBuffer1, pixelSize, bitmapWidth * bitmapHeight, pFile);
-		fclose(pFile);
-
-		if (myTFT.drawBitmap16(40, 40, bmpBuffer1, bitmapWidth, bitmapHeight) != rvlDisplay_Success)
+		std::cout << fileName << " : " << bmp.width() << "x" << bmp.height()
+			<< " " << +bmp.bitsPerPixel() << " bit" << std::endl;
+		if (myTFT.drawBitmapFile(40, 40, bmp) != rvlDisplay_Success)
 		{
 		// Check for success 0x00
-			std::cout << "Warning an Error occurred in drawBitmap16" << std::endl;
-			free(bmpBuffer1);
+			std::cout << "Warning an Error occurred in drawBitmapFile" << std::endl;
 			return;
 		}
 		delayMilliSecRVL(TEST_DELAY5);
 	} // end of for loop
-
-	free(bmpBuffer1); // Free Up Buffer
 	myTFT.fillScreen(RVLC_BLACK);
 } // end of test 
 
 
 // bitmap 16 colour full screen
-// File 1 fourbyteburger240X320.bmp BITMAPV5HEADER offset 132 , 240x320 pixels
+// File 1 fourbyteburger240X320.bmp BITMAPV5HEADER, 240x320 pixels
 // Color space information written
-// bitmap are 240 by 320 
+// Streamed a band of rows at a time, a few kilobytes of RAM instead of 150KB
 void Test305(void)
 {
 	std::cout << "Test 305: 16 bit color image bitmaps from the file system 240 X 320" << std::endl;
 	myTFT.fillScreen(RVLC_BLACK);
 	delayMilliSecRVL(TEST_DELAY1);
 
-	FILE *pFile ;
-	size_t pixelSize = 2; // 16 bit 2 bytes per pixel
-	uint8_t FileHeaderOffset = 132;
-	uint8_t NumberOfFiles  = 1;
-	uint8_t* bmpBuffer = nullptr;
-	uint16_t bitmapWidth = 240;
-	uint16_t bitmapHeight = 320;
-	bmpBuffer = (uint8_t*)malloc((bitmapWidth * bitmapHeight) * pixelSize);
-	if (bmpBuffer == nullptr)
-	{
-		std::cout << "Error Test 305 : MALLOC could not assign memory " << std::endl;
+	if(myTFT.drawBitmapFile(0, 0, "bitmap/bitmap16images/fourbyteburger240X320.bmp") != rvlDisplay_Success)
+	{// Check for success 0x00
+		std::cout << "Warning an Error occurred in drawBitmapFile" << std::endl;
 		return;
 	}
-	for (uint8_t i = 0 ; i < NumberOfFiles ; i++)
-	{
-		switch (i) // select file
-		{
-			case 0: pFile = fopen("bitmap/bitmap16images/fourbyteburger240X320.bmp", "r"); break;
-		}
-
-		if (pFile == nullptr)  // Check file exists
-		{
-			std::cout << "Error Test 305: File does not exist" << std::endl;
-			free(bmpBuffer);
-			return;
-		}
-
-		fseek(pFile, FileHeaderOffset, 0); // Put file in Buffer
-		fread(bmpBuffer, pixelSize, bitmapWidth * bitmapHeight, pFile);
-		fclose(pFile);
-
-		if(myTFT.drawBitmap16(0, 0, bmpBuffer,bitmapWidth, bitmapHeight) != rvlDisplay_Success)
-		{// Check for success 0x00
-			std::cout << "Warning an Error occurred in drawBitmap16" << std::endl;
-			free(bmpBuffer);
-			return;
-		}
-		delayMilliSecRVL(TEST_DELAY5);
-	}
-	free(bmpBuffer);  // Free Up Buffer
+	delayMilliSecRVL(TEST_DELAY5);
 }
 
 //Return UTC time as a std:.string with format "yyyy-mm-dd hh:mm:ss".
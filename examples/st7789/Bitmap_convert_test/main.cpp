@@ -0,0 +1,192 @@
+/*! 
+	@file examples/st7789/Bitmap_convert_test/main.cpp
+	@brief Micro benchmark of the bitmap pixel conversion kernels
+	@details No display is needed, the kernels are timed on their own
+		against the per pixel methods drawBitmap24/16 used before v1.3.0.
+		A 240x320 image of test data is converted repeatedly and the
+		Mega pixels per second printed to console.
+	@test 
+		-# Test 605 24 bit BGR888 to RGB565 big endian conversion speed
+		-# Test 606 16 bit RGB565 little endian to big endian conversion speed
+		-# Test 613 1 bit bitmap to RGB565 big endian expansion speed, drawBitmap
+*/
+
+// Section ::  libraries 
+#include <ctime> // for timing
+#include <cstdlib>
+#include <cstring>
+#include <new>
+#include "ST7789_TFT_LCD_RVL.hpp"
+
+// Section :: Defines   
+#define IMAGE_WIDTH 240
+#define IMAGE_HEIGHT 320
+#define TEST_PASSES 200 // number of times to convert image
+
+//  Section ::  Function Headers 
+void Test605(void); // BGR888 to RGB565BE
+void Test606(void); // RGB565LE to RGB565BE
+void Test613(void); // 1 bit to RGB565BE
+void PerPixelConvert24(const uint8_t* pSrc, uint8_t* pDst, uint32_t pixels);
+void PerPixelConvert16(const uint8_t* pSrc, uint8_t* pDst, uint32_t pixels);
+void PerPixelConvert1(const uint8_t* pSrc, uint8_t* pDst, uint32_t pixels, uint16_t color, uint16_t bgcolor);
+int64_t getTime(); // Utility for timing
+void PrintResult(const char* name, int64_t duration);
+
+//  Section ::  MAIN loop
+
+int main(void) 
+{
+	std::cout << "Bitmap conversion benchmark Start" << std::endl;
+	Test605();
+	Test606();
+	Test613();
+	std::cout << "Bitmap conversion benchmark End" << std::endl;
+	return 0;
+}
+// *** End OF MAIN **
+
+//  Section ::  Function Space 
+
+void Test605(void)
+{
+	std::cout << "Test 605: 24 bit BGR888 to RGB565 BE, " << IMAGE_WIDTH << "x" << IMAGE_HEIGHT << std::endl;
+	const uint32_t pixels = IMAGE_WIDTH * IMAGE_HEIGHT;
+	uint8_t* pSrc = (uint8_t*)malloc(pixels * 3);
+	uint8_t* pDstOld = (uint8_t*)malloc(pixels * 2);
+	uint8_t* pDstNew = (uint8_t*)malloc(pixels * 2);
+	if (pSrc == nullptr || pDstOld == nullptr || pDstNew == nullptr)
+	{
+		std::cout << "Error Test 605 : MALLOC could not assign memory " << std::endl;
+		free(pSrc); free(pDstOld); free(pDstNew);
+		return;
+	}
+	for (uint32_t i = 0; i < pixels * 3; i++) pSrc[i] = rand();
+
+	int64_t start = getTime();
+	for (uint16_t pass = 0; pass < TEST_PASSES; pass++)
+		PerPixelConvert24(pSrc, pDstOld, pixels);
+	PrintResult("Per pixel Color565   ", getTime() - start);
+
+	start = getTime();
+	for (uint16_t pass = 0; pass < TEST_PASSES; pass++)
+		ConvertBGR888toRGB565BE(pSrc, pDstNew, pixels);
+	PrintResult("ConvertBGR888toRGB565BE", getTime() - start);
+
+	if (memcmp(pDstOld, pDstNew, pixels * 2) != 0)
+		std::cout << "Warning Test 605 : outputs differ" << std::endl;
+	free(pSrc); free(pDstOld); free(pDstNew);
+}
+
+void Test606(void)
+{
+	std::cout << "Test 606: 16 bit RGB565 LE to RGB565 BE, " << IMAGE_WIDTH << "x" << IMAGE_HEIGHT << std::endl;
+	const uint32_t pixels = IMAGE_WIDTH * IMAGE_HEIGHT;
+	uint8_t* pSrc = (uint8_t*)malloc(pixels * 2);
+	uint8_t* pDstOld = (uint8_t*)malloc(pixels * 2);
+	uint8_t* pDstNew = (uint8_t*)malloc(pixels * 2);
+	if (pSrc == nullptr || pDstOld == nullptr || pDstNew == nullptr)
+	{
+		std::cout << "Error Test 606 : MALLOC could not assign memory " << std::endl;
+		free(pSrc); free(pDstOld); free(pDstNew);
+		return;
+	}
+	for (uint32_t i = 0; i < pixels * 2; i++) pSrc[i] = rand();
+
+	int64_t start = getTime();
+	for (uint16_t pass = 0; pass < TEST_PASSES; pass++)
+		PerPixelConvert16(pSrc, pDstOld, pixels);
+	PrintResult("Per pixel byte split ", getTime() - start);
+
+	start = getTime();
+	for (uint16_t pass = 0; pass < TEST_PASSES; pass++)
+		ConvertRGB565LEtoBE(pSrc, pDstNew, pixels);
+	PrintResult("ConvertRGB565LEtoBE  ", getTime() - start);
+
+	if (memcmp(pDstOld, pDstNew, pixels * 2) != 0)
+		std::cout << "Warning Test 606 : outputs differ" << std::endl;
+	free(pSrc); free(pDstOld); free(pDstNew);
+}
+
+void Test613(void)
+{
+	std::cout << "Test 613: 1 bit to RGB565 BE, " << IMAGE_WIDTH << "x" << IMAGE_HEIGHT << std::endl;
+	const uint32_t pixels = IMAGE_WIDTH * IMAGE_HEIGHT;
+	const uint16_t color = RVLC_YELLOW, bgcolor = RVLC_BLUE;
+	uint8_t* pSrc = (uint8_t*)malloc(pixels / 8);
+	uint8_t* pDstOld = (uint8_t*)malloc(pixels * 2);
+	uint8_t* pDstNew = (uint8_t*)malloc(pixels * 2);
+	rvlMono1LUT_t* pLUT = new (std::nothrow) rvlMono1LUT_t;
+	if (pSrc == nullptr || pDstOld == nullptr || pDstNew == nullptr || pLUT == nullptr)
+	{
+		std::cout << "Error Test 613 : MALLOC could not assign memory " << std::endl;
+		free(pSrc); free(pDstOld); free(pDstNew); delete pLUT;
+		return;
+	}
+	for (uint32_t i = 0; i < pixels / 8; i++) pSrc[i] = rand();
+
+	int64_t start = getTime();
+	for (uint16_t pass = 0; pass < TEST_PASSES; pass++)
+		PerPixelConvert1(pSrc, pDstOld, pixels, color, bgcolor);
+	PrintResult("Per pixel shift test ", getTime() - start);
+
+	start = getTime();
+	BuildMono1LUT(*pLUT, color, bgcolor);
+	for (uint16_t pass = 0; pass < TEST_PASSES; pass++)
+		ConvertMono1toRGB565BE(pSrc, 0, pDstNew, pixels, *pLUT);
+	PrintResult("ConvertMono1toRGB565BE", getTime() - start);
+
+	if (memcmp(pDstOld, pDstNew, pixels * 2) != 0)
+		std::cout << "Warning Test 613 : outputs differ" << std::endl;
+	free(pSrc); free(pDstOld); free(pDstNew); delete pLUT;
+}
+
+// The conversion as done per pixel by drawBitmap24 before v1.3.0
+void PerPixelConvert24(const uint8_t* pSrc, uint8_t* pDst, uint32_t pixels)
+{
+	for (uint32_t i = 0; i < pixels; i++)
+	{
+		uint8_t b = pSrc[i * 3], g = pSrc[i * 3 + 1], r = pSrc[i * 3 + 2];
+		uint16_t color = ((r & 0xF8) << 8) | ((g & 0xFC) << 3) | (b >> 3);
+		pDst[i * 2] = color >> 8;
+		pDst[i * 2 + 1] = color;
+	}
+}
+
+// The conversion as done per pixel by drawBitmap16 before v1.3.0
+void PerPixelConvert16(const uint8_t* pSrc, uint8_t* pDst, uint32_t pixels)
+{
+	for (uint32_t i = 0; i < pixels; i++)
+	{
+		uint16_t color = pSrc[i * 2] | (pSrc[i * 2 + 1] << 8);
+		pDst[i * 2] = color >> 8;
+		pDst[i * 2 + 1] = color;
+	}
+}
+
+// The expansion as done per pixel by drawBitmap before v1.3.0
+void PerPixelConvert1(const uint8_t* pSrc, uint8_t* pDst, uint32_t pixels, uint16_t color, uint16_t bgcolor)
+{
+	for (uint32_t i = 0; i < pixels; i++)
+	{
+		uint16_t mycolor = (pSrc[i / 8] & (0x80 >> (i & 7))) ? color : bgcolor;
+		pDst[i * 2] = mycolor >> 8;
+		pDst[i * 2 + 1] = mycolor;
+	}
+}
+
+void PrintResult(const char* name, int64_t duration)
+{
+	double mpixels = (double)IMAGE_WIDTH * IMAGE_HEIGHT * TEST_PASSES / duration;
+	std::cout << name << " : " << duration / TEST_PASSES << " uS per image, " << mpixels << " Mpixels/s" << std::endl;
+}
+
+int64_t getTime() {
+	struct timespec tms;
+	if (clock_gettime(CLOCK_MONOTONIC,&tms)) return -1;
+	int64_t micros = tms.tv_sec * 1000000;
+	micros += tms.tv_nsec/1000;
+	return micros;
+}
+
+// *************** EOF ****************
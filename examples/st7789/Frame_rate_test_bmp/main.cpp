@@ -9,8 +9,15 @@
 		814 frames, 10 sec, 81.3904 fps  at 8Mhz SPI Baud rate, HW SPI 0
 		349 frames, 10 sec, 34.8921 fps  at 8Mhz SPI Baud rate, HW SPI 1 (aux)
 		32 frames, 10 sec, 3.17005 fps  at Software SPI 
+		Test 602 draws a full screen 240x320 16 bit bitmap, first from BMP
+		order data (little endian, bottom up) then from the same data pre-converted
+		to display order (big endian, top down) which is sent with no copy.
+		Test 603 draws the 24 bit bitmaps of test 601 with and without an
+		image cache attached and prints the cache statistics.
 	@test 
 		-# Test 601 Frame rate per second (FPS) test. 24bit bitmaps.
+		-# Test 602 Frame rate per second (FPS) test. 16bit bitmap 240x320.
+		-# Test 603 Frame rate per second (FPS) test. 24bit bitmaps, image cache.
 */
 
 // Section ::  libraries 
@@ -23,6 +30,7 @@
 #define TEST_DELAY1 1000
 #define TEST_DELAY2 2000
 #define TEST_DELAY5 5000
+#define IMAGE_CACHE_BUDGET (64 * 1024) // bytes, room for two of the three 128x128 images
 
 // Test bitmaps related
 #define myBMPWidth 128 //size in pixels of bitmap 
@@ -39,6 +47,8 @@ ST7789_TFT myTFT;
 
 int8_t Setup(void); // setup + user options
 void TestFPS(void); // Frames per second 24 color bitmap test,
+void TestFPS16(void); // Frames per second 16 color full screen bitmap test
+void TestFPSCache(void); // Frames per second 24 color bitmap test, image cache
 void EndTests(void);
 
 int64_t getTime(); // Utility for FPS test
@@ -51,6 +61,10 @@ int main(void)
 	if(Setup() != 0)return -1;
 	myTFT.TFTsetRotation(myTFT.TFT_Degrees_90); // Rotate display
 	TestFPS();
+	myTFT.TFTsetRotation(myTFT.TFT_Degrees_0);
+	TestFPS16();
+	myTFT.TFTsetRotation(myTFT.TFT_Degrees_90);
+	TestFPSCache();
 	EndTests();
 	return 0;
 }
@@ -143,6 +157,103 @@ void TestFPS(void) {
 }
 
 
+/*!
+ *@brief Frames per second test, 16 bit color 240x320 bitmap, BMP order then display order
+*/
+void TestFPS16(void) {
+	const uint16_t bmpWidth = 240;
+	const uint16_t bmpHeight = 320;
+	const uint32_t bmpBytes = bmpWidth * bmpHeight * 2;
+	uint8_t FileHeaderOffset = 138; // BITMAPV5HEADER
+	FILE *pFile = fopen("bitmap/bitmap16images/fourbyteburger240X320.bmp", "r");
+	if (pFile == nullptr)
+	{
+		std::cout << "Error TestFPS16 : File does not exist" << std::endl;
+		return;
+	}
+	uint8_t* bmpLE = (uint8_t*)malloc(bmpBytes);
+	uint8_t* bmpBE = (uint8_t*)malloc(bmpBytes);
+	if (bmpLE == nullptr || bmpBE == nullptr)
+	{
+		std::cout << "Error TestFPS16 : MALLOC could not assign memory " << std::endl;
+		free(bmpLE); free(bmpBE); fclose(pFile);
+		return;
+	}
+	fseek(pFile, FileHeaderOffset, 0);
+	fread(bmpLE, 2, bmpWidth * bmpHeight, pFile);
+	fclose(pFile);
+	// Pre-convert a copy to display order, top down big endian
+	for (uint16_t row = 0; row < bmpHeight; row++)
+		ConvertRGB565LEtoBE(bmpLE + (bmpHeight - 1 - row) * bmpWidth * 2, bmpBE + row * bmpWidth * 2, bmpWidth);
+
+	for (uint8_t mode = 0; mode < 2; mode++)
+	{
+		int64_t start = getTime(), duration = 0;
+		uint32_t frames = 0;
+		while(duration < 5000000) { // Run for ~5sec
+			if (mode == 0)
+				myTFT.drawBitmap16(0, 0, bmpLE, bmpWidth, bmpHeight);
+			else
+				myTFT.drawBitmap16(0, 0, bmpBE, bmpWidth, bmpHeight, true);
+			frames++;
+			duration = getTime() - start;
+		}
+		double fps = (double)frames / ((double)duration / 1000000);
+		double mbytes = (double)frames * bmpBytes / duration;
+		std::cout << (mode == 0 ? "BMP order     : " : "Display order : ") << frames << " frames, "
+			<< fps << " fps, " << mbytes << " MB/s" << std::endl;
+	}
+	free(bmpLE);
+	free(bmpBE);
+}
+
+/*!
+ *@brief Frames per second test, 24 color bitmaps, without then with an image cache.
+	The cache budget holds two of the three images, so with 3 images drawn in turn
+	least recently used eviction thrashes, with 2 every draw after the first is a hit.
+*/
+void TestFPSCache(void) {
+	myTFT.fillScreen(RVLC_BLACK);
+	uint8_t* img[numberOfFiles] = { 
+		loadImage((char*)"bitmap/bitmap24images/24pic2.bmp"),
+		loadImage((char*)"bitmap/bitmap24images/24pic4.bmp"),
+		loadImage((char*)"bitmap/bitmap24images/24pic5.bmp")
+	};
+	for (uint8_t i=0; i< numberOfFiles ;i++)
+	{
+		if (img[i] == nullptr){ 
+			for(uint8_t j=0; j< numberOfFiles; j++) free(img[j]);
+			return;
+		}
+	}
+	imageCache cache(IMAGE_CACHE_BUDGET);
+	const char * modeNames[3] = {"No cache         ", "Cache, 3 images  ", "Cache, 2 images  "};
+	for (uint8_t mode = 0; mode < 3; mode++)
+	{
+		myTFT.setImageCache(mode == 0 ? nullptr : &cache);
+		cache.clear();
+		cache.resetStats();
+		uint8_t images = (mode == 2) ? 2 : numberOfFiles;
+		int64_t start = getTime(), duration = 0;
+		uint32_t frames = 0;
+		while(duration < 5000000) { // Run for ~5sec
+			myTFT.drawBitmap24(35, 50, img[frames % images], myBMPWidth, myBMPHeight);
+			frames++;
+			duration = getTime() - start;
+		}
+		double fps = (double)frames / ((double)duration / 1000000);
+		std::cout << modeNames[mode] << ": " << frames << " frames, " << fps << " fps" << std::endl;
+		if (mode != 0)
+		{
+			rvlImageCache_Stats_t stats = cache.getStats();
+			std::cout << "  hits " << stats.hits << " misses " << stats.misses << " evictions " << stats.evictions
+				<< " bytes " << stats.bytesUsed << "/" << stats.budgetBytes << std::endl;
+		}
+	}
+	myTFT.setImageCache(nullptr);
+	for(int i=0; i< numberOfFiles; i++) free(img[i]);
+}
+
 void EndTests(void)
 {
 	char teststr1[] = "Tests over";
@@ -0,0 +1,161 @@
+/*! 
+	@file examples/st7789/Frame_rate_test_bundle/main.cpp
+	@brief Frame rate test. Asset bundle images against BMP files
+	@note See USER OPTIONS 1-3 in SETUP function
+	@details The bundle must be built first, from the library root folder:
+		make tools && make bundle BUNDLE_DIR=examples/bitmap/bitmap16images
+		which writes examples/bitmap/assets.rvlb. Each image in the bundle is
+		shown, then a full screen image is drawn for 5 seconds from the bundle
+		and for 5 seconds from its BMP file, draws per second are printed.
+	@test 
+		-# Test 607 Asset bundle open time, draws per second bundle versus BMP file
+*/
+
+// Section ::  libraries 
+#include <bcm2835.h> // for SPI GPIO and delays.
+#include <ctime> // for test FPS
+#include "ST7789_TFT_LCD_RVL.hpp"
+
+// Section :: Defines   
+//  Test related defines 
+#define TEST_DELAY1 1000
+#define TEST_DELAY5 5000
+#define TEST_RUN_TIME 5000000 // uS each draw test runs for
+#define BUNDLE_PATH "bitmap/assets.rvlb"
+#define FULL_SCREEN_NAME "fourbyteburger240X320" // 240x320 image in bundle
+#define FULL_SCREEN_BMP "bitmap/bitmap16images/fourbyteburger240X320.bmp"
+
+// Section :: Globals 
+ST7789_TFT myTFT;
+// Display size in pixels
+#define myTFTWidth 240
+#define myTFTHeight 320
+
+//  Section ::  Function Headers 
+
+int8_t Setup(void); // setup + user options
+void Test607(void); // asset bundle
+void EndTests(void);
+
+int64_t getTime(); // Utility for FPS test
+
+//  Section ::  MAIN loop
+
+int main(void) 
+{
+	if(Setup() != 0)return -1;
+	myTFT.TFTsetRotation(myTFT.TFT_Degrees_0);
+	Test607();
+	myTFT.TFTsetRotation(myTFT.TFT_Degrees_90);
+	EndTests();
+	return 0;
+}
+// *** End OF MAIN **
+
+
+//  Section ::  Function Space 
+
+int8_t Setup(void)
+{
+	std::cout << "TFT Start Test 607 asset bundle" << std::endl;
+	if(!bcm2835_init())
+	{
+		std::cout << "Error 1201 Problem with init bcm2835 library" << std::endl;
+		return 2;
+	}
+	
+// ** USER OPTION 1 GPIO/SPI TYPE HW OR SW **
+	int8_t RST_TFT  =  25;
+	int8_t DC_TFT   =  24;
+	myTFT.TFTSetupGPIO(RST_TFT, DC_TFT);
+//*********************************************
+
+// ** USER OPTION 2 Screen Setup **
+	uint8_t OFFSET_COL = 0;  // 2, These offsets can be adjusted for any issues->
+	uint8_t OFFSET_ROW = 0; // 3, with manufacture tolerance/defects
+	myTFT.TFTInitScreenSize(OFFSET_COL, OFFSET_ROW ,myTFTWidth , myTFTHeight);
+// ***********************************
+
+// ** USER OPTION 3  SPI baud rate + SPI_CE_PIN**
+	uint32_t SCLK_FREQ =  8000000 ; // HW Spi freq in Hertz , MAX 125 Mhz MIN 30Khz
+	uint8_t SPI_CE_PIN = 0; // which HW SPI chip enable pin to use,  0 or 1
+	if(myTFT.TFTInitSPI( SCLK_FREQ, SPI_CE_PIN) != rvlDisplay_Success)
+	{
+		bcm2835_close(); //Close lib & /dev/mem, deallocating mem
+		return 3;
+	}
+//*****************************
+	std::cout << "ST7789 library version : " << GetRVLibVersionNum()<< std::endl;
+	std::cout <<"bcm2835 library version :" << bcm2835_version() << std::endl;
+	delayMilliSecRVL(50);
+	return 0;
+}
+
+/*!
+ *@brief Asset bundle test, open time, show each image, draws per second bundle v BMP file
+*/
+void Test607(void) {
+	assetBundle bundle;
+	int64_t start = getTime();
+	if (bundle.open(BUNDLE_PATH) != rvlDisplay_Success)
+	{
+		std::cout << "Error Test 607 : build the bundle first, see file header" << std::endl;
+		return;
+	}
+	std::cout << "Bundle open : " << bundle.count() << " images in " << getTime() - start << " uS" << std::endl;
+
+	for (uint16_t i = 0; i < bundle.count(); i++)
+	{
+		const rvlAsset_t* asset = bundle.at(i);
+		std::cout << asset->name << " : " << asset->width << "x" << asset->height << std::endl;
+		myTFT.fillScreen(RVLC_BLACK);
+		myTFT.drawAsset(0, 0, asset);
+		delayMilliSecRVL(TEST_DELAY1);
+	}
+
+	const rvlAsset_t* fullScreen = bundle.find(FULL_SCREEN_NAME);
+	if (fullScreen == nullptr)
+	{
+		std::cout << "Error Test 607 : " << FULL_SCREEN_NAME << " not in bundle" << std::endl;
+		return;
+	}
+	for (uint8_t mode = 0; mode < 2; mode++)
+	{
+		int64_t duration = 0;
+		uint32_t draws = 0;
+		start = getTime();
+		while(duration < TEST_RUN_TIME) {
+			if (mode == 0)
+				myTFT.drawAsset(0, 0, fullScreen);
+			else
+				myTFT.drawBitmapFile(0, 0, FULL_SCREEN_BMP);
+			draws++;
+			duration = getTime() - start;
+		}
+		double fps = (double)draws / ((double)duration / 1000000);
+		std::cout << (mode == 0 ? "Bundle   : " : "BMP file : ") << draws << " draws, " << fps << " draws per second" << std::endl;
+	}
+}
+
+void EndTests(void)
+{
+	char teststr1[] = "Tests over";
+	myTFT.setFont(font_orla);
+	myTFT.fillScreen(RVLC_BLACK);
+	myTFT.writeCharString(35, 50, teststr1);
+	delayMilliSecRVL(TEST_DELAY5);
+	myTFT.TFTPowerDown(); // Power down device
+	bcm2835_close(); // Close the bcm2835 library
+	std::cout << "TFT End" << std::endl;
+}
+
+int64_t getTime() {
+	struct timespec tms;
+	if (clock_gettime(CLOCK_REALTIME,&tms)) return -1;
+	int64_t micros = tms.tv_sec * 1000000;
+	micros += tms.tv_nsec/1000;
+	if (tms.tv_nsec % 1000 >= 500) ++micros;
+	return micros;
+}
+
+// *************** EOF ****************
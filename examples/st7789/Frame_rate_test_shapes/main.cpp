@@ -0,0 +1,137 @@
+/*! 
+	@file examples/st7789/Frame_rate_test_shapes/main.cpp
+	@brief Frame rate test. Filled shapes per second
+	@note See USER OPTIONS 1-3 in SETUP function
+	@details Each filled shape type is drawn as many times as possible
+		in 5 seconds and the fills per second are printed to console.
+	@test 
+		-# Test 604 Fills per second, circles, rounded rectangles, triangles and a screen sized triangle
+*/
+
+// Section ::  libraries 
+#include <bcm2835.h> // for SPI GPIO and delays.
+#include <ctime> // for test FPS
+#include "ST7789_TFT_LCD_RVL.hpp"
+
+// Section :: Defines   
+//  Test related defines 
+#define TEST_DELAY1 1000
+#define TEST_DELAY5 5000
+#define TEST_RUN_TIME 5000000 // uS each shape test runs for
+
+// Section :: Globals 
+ST7789_TFT myTFT;
+// Display size in pixels
+#define myTFTWidth 240
+#define myTFTHeight 320
+
+//  Section ::  Function Headers 
+
+int8_t Setup(void); // setup + user options
+void TestFillsPerSecond(void);
+void EndTests(void);
+
+int64_t getTime(); // Utility for FPS test
+
+//  Section ::  MAIN loop
+
+int main(void) 
+{
+	if(Setup() != 0)return -1;
+	myTFT.TFTsetRotation(myTFT.TFT_Degrees_90); // Rotate display
+	TestFillsPerSecond();
+	EndTests();
+	return 0;
+}
+// *** End OF MAIN **
+
+
+//  Section ::  Function Space 
+
+int8_t Setup(void)
+{
+	std::cout << "TFT Start Test 604 fills per second" << std::endl;
+	if(!bcm2835_init())
+	{
+		std::cout << "Error 1201 Problem with init bcm2835 library" << std::endl;
+		return 2;
+	}
+	
+// ** USER OPTION 1 GPIO/SPI TYPE HW OR SW **
+	int8_t RST_TFT  =  25;
+	int8_t DC_TFT   =  24;
+	myTFT.TFTSetupGPIO(RST_TFT, DC_TFT);
+//*********************************************
+
+// ** USER OPTION 2 Screen Setup **
+	uint8_t OFFSET_COL = 0;  // 2, These offsets can be adjusted for any issues->
+	uint8_t OFFSET_ROW = 0; // 3, with manufacture tolerance/defects
+	myTFT.TFTInitScreenSize(OFFSET_COL, OFFSET_ROW ,myTFTWidth , myTFTHeight);
+// ***********************************
+
+// ** USER OPTION 3  SPI baud rate + SPI_CE_PIN**
+	uint32_t SCLK_FREQ =  8000000 ; // HW Spi freq in Hertz , MAX 125 Mhz MIN 30Khz
+	uint8_t SPI_CE_PIN = 0; // which HW SPI chip enable pin to use,  0 or 1
+	if(myTFT.TFTInitSPI( SCLK_FREQ, SPI_CE_PIN) != rvlDisplay_Success)
+	{
+		bcm2835_close(); //Close lib & /dev/mem, deallocating mem
+		return 3;
+	}
+//*****************************
+	std::cout << "ST7789 library version : " << GetRVLibVersionNum()<< std::endl;
+	std::cout <<"bcm2835 library version :" << bcm2835_version() << std::endl;
+	delayMilliSecRVL(50);
+	return 0;
+}
+
+/*!
+ *@brief Fills per second test, circles, rounded rectangles and triangles.
+ *	The screen sized triangle has edges long enough to need 32 bit edge steps.
+*/
+void TestFillsPerSecond(void) {
+	const char * shapeNames[4] = {"circle r40", "round rect 100x60 r15", "triangle", "triangle screen sized"};
+	for (uint8_t shape = 0; shape < 4; shape++)
+	{
+		myTFT.fillScreen(RVLC_BLACK);
+		int64_t start = getTime(), duration = 0;
+		uint32_t fills = 0;
+		while(duration < TEST_RUN_TIME) {
+			uint16_t color = (fills & 1) ? RVLC_RED : RVLC_BLUE;
+			switch (shape)
+			{
+				case 0: myTFT.fillCircle(160, 120, 40, color); break;
+				case 1: myTFT.fillRoundRect(110, 90, 100, 60, 15, color); break;
+				case 2: myTFT.fillTriangle(110, 170, 160, 70, 210, 170, color); break;
+				case 3: myTFT.fillTriangle(0, 0, 239, 10, 5, 319, color); break;
+			}
+			fills++;
+			duration = getTime() - start;
+		}
+		double fps = (double)fills / ((double)duration / 1000000);
+		std::cout << shapeNames[shape] << " : " << fills << " fills, " << fps << " fills per second" << std::endl;
+		delayMilliSecRVL(TEST_DELAY1);
+	}
+}
+
+void EndTests(void)
+{
+	char teststr1[] = "Tests over";
+	myTFT.setFont(font_orla);
+	myTFT.fillScreen(RVLC_BLACK);
+	myTFT.writeCharString(35, 50, teststr1);
+	delayMilliSecRVL(TEST_DELAY5);
+	myTFT.TFTPowerDown(); // Power down device
+	bcm2835_close(); // Close the bcm2835 library
+	std::cout << "TFT End" << std::endl;
+}
+
+int64_t getTime() {
+	struct timespec tms;
+	if (clock_gettime(CLOCK_REALTIME,&tms)) return -1;
+	int64_t micros = tms.tv_sec * 1000000;
+	micros += tms.tv_nsec/1000;
+	if (tms.tv_nsec % 1000 >= 500) ++micros;
+	return micros;
+}
+
+// *************** EOF ****************
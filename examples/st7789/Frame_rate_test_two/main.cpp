@@ -6,6 +6,7 @@
 		16 FPS recorded V 1.0.2 at 8MHz TFT SPI0
 		10 FPS recorded V 1.0.2 at 8MHz TFT SPI1
 		3 FPS recorded  V 1.0.2 at software SPI
+		The count and fps values are numericFields, only their changed digits are sent.
 	@test 
 		-# Test 603 Frame rate per second (FPS) test text + graphics
 */
@@ -30,6 +31,8 @@ uint16_t myTFTHeight = 320; // Screen height in pixels
 uint16_t countLimit = 1000;
 uint16_t count  = 0;
 uint64_t  previousCounter =0;
+numericField countField(myTFT, 25, 70, 4, font_orla); // frame count, redraws changed digits only
+numericField fpsField(myTFT, 25, 110, 4, font_orla); // frames per second
 
 // =============== Function prototype ================
 int8_t SetupHWSPI(void);
@@ -105,6 +108,8 @@ void TestFPS() {
 	myTFT.TFTsetRotation(myTFT.TFT_Degrees_90);
 	myTFT.fillScreen(RVLC_BLACK);
 	myTFT.setFont(font_orla);
+	char fpsLabel[] = " fps";
+	myTFT.writeCharString(25 + 4 * 16, 110, fpsLabel);
 	
 	std::cout << "FPS test: text + graphics ends at :: " << countLimit << std::endl;
 	while (count < countLimit)
@@ -125,8 +130,7 @@ void display(long currentFramerate, int count)
 
 	myTFT.setCursor(25, 30);
 	myTFT.print("G Lyons");
-	myTFT.setCursor(25, 70);
-	myTFT.print(count);
+	countField.setValue(count);
 
 	// Values to count frame rate per second
 	static long lastFramerate = 0;
@@ -140,9 +144,7 @@ void display(long currentFramerate, int count)
 		previousCounter = currentCounter;
 	}
 
-	myTFT.setCursor(25, 110);
-	myTFT.print(fps);
-	myTFT.print(" fps");
+	fpsField.setValue(fps);
 	myTFT.setCursor(25, 150);
 	myTFT.print(GetRVLibVersionNum());
 
@@ -0,0 +1,408 @@
+/*! 
+	@file examples/st7789/Image_formats_test/main.cpp
+	@brief Image format test. Draw time and file size, compressed formats against BMP
+	@note See USER OPTIONS 1-3 in SETUP function
+	@details The RLE565 and QOI images must be made first, from the library root folder:
+		make tools && make rle && make qoi
+		which writes examples/bitmap/rle/<name>.rle for the 16 bit test images
+		and examples/bitmap/qoi/<name>.qoi for the 24 bit test images.
+		The JPEG test images are in examples/bitmap/jpegimages.
+		The animation must be made first, make tools && make anim, which writes
+		examples/bitmap/spinner.rva from the frames in examples/bitmap/animframes.
+		Each image is drawn from its BMP file then from its compressed file,
+		TEST_PASSES times each, and the average time per draw is printed.
+		File read time is part of every draw.
+	@test 
+		-# Test 608 RLE565 file against BMP file, size and draw time
+		-# Test 609 QOI file (streamed decode) against BMP file loaded + drawBitmap24
+		-# Test 610 JPEG file draw time at full, 1/2, 1/4 and 1/8 scale, malformed file rejected
+		-# Test 612 Delta frame animation against BMP frames, bus bytes and time per loop
+*/
+
+// Section ::  libraries 
+#include <bcm2835.h> // for SPI GPIO and delays.
+#include <ctime> // for test timing
+#include <sys/stat.h> // for file size
+#include "ST7789_TFT_LCD_RVL.hpp"
+
+// Section :: Defines   
+//  Test related defines 
+#define TEST_DELAY1 1000
+#define TEST_DELAY5 5000
+#define TEST_PASSES 20 // draws of each image in each format
+
+// Section :: Globals 
+ST7789_TFT myTFT;
+// Display size in pixels
+#define myTFTWidth 240
+#define myTFTHeight 320
+
+// Test images, BMP file and the same image in RLE565
+const char* bmpFiles[] = {
+	"bitmap/bitmap16images/16pic1.bmp",
+	"bitmap/bitmap16images/16pic2.bmp",
+	"bitmap/bitmap16images/16pic3.bmp",
+	"bitmap/bitmap16images/fourbyteburger240X320.bmp"
+};
+const char* rleFiles[] = {
+	"bitmap/rle/16pic1.rle",
+	"bitmap/rle/16pic2.rle",
+	"bitmap/rle/16pic3.rle",
+	"bitmap/rle/fourbyteburger240X320.rle"
+};
+const uint8_t numberOfImages = 4;
+
+// 24 bit test images, BMP file and the same image in QOI
+const char* bmp24Files[] = {
+	"bitmap/bitmap24images/24pic2.bmp",
+	"bitmap/bitmap24images/24pic4.bmp",
+	"bitmap/bitmap24images/24pic5.bmp",
+	"bitmap/bitmap24images/24pic7_220X240.bmp"
+};
+const char* qoiFiles[] = {
+	"bitmap/qoi/24pic2.qoi",
+	"bitmap/qoi/24pic4.qoi",
+	"bitmap/qoi/24pic5.qoi",
+	"bitmap/qoi/24pic7_220X240.qoi"
+};
+const uint8_t numberOf24Images = 4;
+
+// JPEG test images
+const char* jpegFiles[] = {
+	"bitmap/jpegimages/24pic2.jpg",
+	"bitmap/jpegimages/24pic7_220X240.jpg",
+	"bitmap/jpegimages/fourbyteburger240X320.jpg"
+};
+const uint8_t numberOfJPEGImages = 3;
+
+// Delta frame animation and the BMP frames it was made from
+const char* animFile = "bitmap/spinner.rva";
+const char* animFrameFormat = "bitmap/animframes/spinner_%02u.bmp";
+
+//  Section ::  Function Headers 
+
+int8_t Setup(void); // setup + user options
+void Test608(void); // RLE565 v BMP
+void Test609(void); // QOI v BMP + drawBitmap24
+void Test610(void); // JPEG at each scale
+void Test612(void); // delta frame animation v BMP frames
+void EndTests(void);
+
+int64_t getTime(); // Utility for timing
+long fileSize(const char* path); // Utility, size in bytes or -1
+int64_t timeDraws(const char* path, rvlDisplay_Return_Codes_e (ST7789_TFT::*draw)(int16_t, int16_t, const char*));
+rvlDisplay_Return_Codes_e drawBMP24(int16_t x, int16_t y, const char* path);
+int64_t timeBMP24Draws(const char* path);
+int64_t timeJPEGDraws(const char* path, jpegDecoder::JPEGScale_e scale);
+
+//  Section ::  MAIN loop
+
+int main(void) 
+{
+	if(Setup() != 0)return -1;
+	myTFT.TFTsetRotation(myTFT.TFT_Degrees_0);
+	Test608();
+	Test609();
+	Test610();
+	Test612();
+	myTFT.TFTsetRotation(myTFT.TFT_Degrees_90);
+	EndTests();
+	return 0;
+}
+// *** End OF MAIN **
+
+
+//  Section ::  Function Space 
+
+int8_t Setup(void)
+{
+	std::cout << "TFT Start Test 608-612 image formats" << std::endl;
+	if(!bcm2835_init())
+	{
+		std::cout << "Error 1201 Problem with init bcm2835 library" << std::endl;
+		return 2;
+	}
+	
+// ** USER OPTION 1 GPIO/SPI TYPE HW OR SW **
+	int8_t RST_TFT  =  25;
+	int8_t DC_TFT   =  24;
+	myTFT.TFTSetupGPIO(RST_TFT, DC_TFT);
+//*********************************************
+
+// ** USER OPTION 2 Screen Setup **
+	uint8_t OFFSET_COL = 0;  // 2, These offsets can be adjusted for any issues->
+	uint8_t OFFSET_ROW = 0; // 3, with manufacture tolerance/defects
+	myTFT.TFTInitScreenSize(OFFSET_COL, OFFSET_ROW ,myTFTWidth , myTFTHeight);
+// ***********************************
+
+// ** USER OPTION 3  SPI baud rate + SPI_CE_PIN**
+	uint32_t SCLK_FREQ =  8000000 ; // HW Spi freq in Hertz , MAX 125 Mhz MIN 30Khz
+	uint8_t SPI_CE_PIN = 0; // which HW SPI chip enable pin to use,  0 or 1
+	if(myTFT.TFTInitSPI( SCLK_FREQ, SPI_CE_PIN) != rvlDisplay_Success)
+	{
+		bcm2835_close(); //Close lib & /dev/mem, deallocating mem
+		return 3;
+	}
+//*****************************
+	std::cout << "ST7789 library version : " << GetRVLibVersionNum()<< std::endl;
+	std::cout <<"bcm2835 library version :" << bcm2835_version() << std::endl;
+	delayMilliSecRVL(50);
+	return 0;
+}
+
+/*!
+ *@brief RLE565 file against BMP file, file size and draw time
+*/
+void Test608(void) {
+	for (uint8_t i = 0; i < numberOfImages; i++)
+	{
+		myTFT.fillScreen(RVLC_BLACK);
+		int64_t bmpTime = timeDraws(bmpFiles[i], &ST7789_TFT::drawBitmapFile);
+		int64_t rleTime = timeDraws(rleFiles[i], &ST7789_TFT::drawRLE565File);
+		if (bmpTime < 0 || rleTime < 0)
+		{
+			std::cout << "Error Test 608 : run make tools && make rle first, see file header" << std::endl;
+			return;
+		}
+		std::cout << bmpFiles[i] << std::endl;
+		std::cout << "  BMP    : " << fileSize(bmpFiles[i]) << " bytes, " << bmpTime << " uS per draw" << std::endl;
+		std::cout << "  RLE565 : " << fileSize(rleFiles[i]) << " bytes, " << rleTime << " uS per draw" << std::endl;
+		delayMilliSecRVL(TEST_DELAY1);
+	}
+}
+
+/*!
+ *@brief QOI file, decoded a band at a time straight to the display, against
+ *	the BMP file read into memory and drawn by drawBitmap24
+*/
+void Test609(void) {
+	for (uint8_t i = 0; i < numberOf24Images; i++)
+	{
+		myTFT.fillScreen(RVLC_BLACK);
+		int64_t bmpTime = timeBMP24Draws(bmp24Files[i]);
+		int64_t qoiTime = timeDraws(qoiFiles[i], &ST7789_TFT::drawQOIFile);
+		if (bmpTime < 0 || qoiTime < 0)
+		{
+			std::cout << "Error Test 609 : run make tools && make qoi first, see file header" << std::endl;
+			return;
+		}
+		std::cout << bmp24Files[i] << std::endl;
+		std::cout << "  BMP + drawBitmap24 : " << fileSize(bmp24Files[i]) << " bytes, " << bmpTime << " uS per draw" << std::endl;
+		std::cout << "  QOI                : " << fileSize(qoiFiles[i]) << " bytes, " << qoiTime << " uS per draw" << std::endl;
+		delayMilliSecRVL(TEST_DELAY1);
+	}
+}
+
+/*!
+ *@brief JPEG file draw time at each scale, decoded a MCU row at a time
+ *	straight to the display, the scaled images are then shown side by side.
+ *	A malformed file, a Huffman table with more codes than fit, must be rejected.
+*/
+void Test610(void) {
+	const char* scaleNames[] = {"1/1", "1/2", "1/4", "1/8"};
+	// SOI then a DHT with 200 codes of length 1, whole segment and cut short at 25 bytes
+	const uint8_t badJPEG[224] = {0xFF, 0xD8, 0xFF, 0xC4, 0x00, 0xDB, 0x00, 200};
+	if (myTFT.drawJPEG(0, 0, badJPEG, sizeof(badJPEG)) == rvlDisplay_Success ||
+		myTFT.drawJPEG(0, 0, badJPEG, 25) == rvlDisplay_Success)
+	{
+		std::cout << "Error Test 610 : malformed JPEG was not rejected" << std::endl;
+		return;
+	}
+	for (uint8_t i = 0; i < numberOfJPEGImages; i++)
+	{
+		myTFT.fillScreen(RVLC_BLACK);
+		std::cout << jpegFiles[i] << " : " << fileSize(jpegFiles[i]) << " bytes" << std::endl;
+		for (uint8_t scale = jpegDecoder::JPEG_Scale_1; scale <= jpegDecoder::JPEG_Scale_8; scale++)
+		{
+			int64_t jpegTime = timeJPEGDraws(jpegFiles[i], (jpegDecoder::JPEGScale_e)scale);
+			if (jpegTime < 0)
+			{
+				std::cout << "Error Test 610 : JPEG draw failed" << std::endl;
+				return;
+			}
+			std::cout << "  JPEG " << scaleNames[scale] << " : " << jpegTime << " uS per draw" << std::endl;
+		}
+		myTFT.fillScreen(RVLC_BLACK);
+		int16_t x = 0;
+		for (uint8_t scale = jpegDecoder::JPEG_Scale_2; scale <= jpegDecoder::JPEG_Scale_8; scale++)
+		{
+			jpegDecoder jpeg;
+			jpeg.setScale((jpegDecoder::JPEGScale_e)scale);
+			if (jpeg.open(jpegFiles[i]) != rvlDisplay_Success) return;
+			myTFT.drawJPEG(x, 0, jpeg);
+			x += jpeg.scaledWidth() + 2;
+		}
+		delayMilliSecRVL(TEST_DELAY1);
+	}
+}
+
+/*!
+ *@brief Delta frame animation, only changed rectangles sent each frame, against
+ *	drawing every frame whole from its BMP file. Bus bytes and time per loop,
+ *	then the animation is played at its own frame rate.
+*/
+void Test612(void) {
+	deltaAnimation anim;
+	if (anim.open(animFile) != rvlDisplay_Success)
+	{
+		std::cout << "Error Test 612 : run make tools && make anim first, see file header" << std::endl;
+		return;
+	}
+	myTFT.fillScreen(RVLC_BLACK);
+	const int16_t x = (myTFTWidth - anim.width()) / 2, y = (myTFTHeight - anim.height()) / 2;
+	const uint16_t frames = anim.frameCount();
+	const uint16_t loopFrame = anim.hasLoopFrame() ? frames : 0;
+	char path[64];
+
+	// Whole frames from the BMP files
+	int64_t start = getTime();
+	for (uint16_t pass = 0; pass < TEST_PASSES; pass++)
+	{
+		for (uint16_t i = 0; i < frames; i++)
+		{
+			snprintf(path, sizeof(path), animFrameFormat, i);
+			if (myTFT.drawBitmapFile(x, y, path) != rvlDisplay_Success)
+			{
+				std::cout << "Error Test 612 : BMP frame draw failed " << path << std::endl;
+				return;
+			}
+		}
+	}
+	int64_t bmpTime = (getTime() - start) / TEST_PASSES;
+	uint32_t bmpBytes = frames * ((uint32_t)anim.width() * anim.height() * 2 + RVL_ANIM_WINDOW_BYTES);
+
+	// Changed rectangles only, frame 0 once then the loop frame each pass
+	myTFT.drawAnimationFrame(x, y, anim, 0);
+	start = getTime();
+	for (uint16_t pass = 0; pass < TEST_PASSES; pass++)
+	{
+		for (uint16_t i = 1; i <= frames; i++)
+		{
+			if (myTFT.drawAnimationFrame(x, y, anim, (i == frames) ? loopFrame : i) != rvlDisplay_Success)
+			{
+				std::cout << "Error Test 612 : animation frame draw failed" << std::endl;
+				return;
+			}
+		}
+	}
+	int64_t animTime = (getTime() - start) / TEST_PASSES;
+
+	std::cout << animFile << " : " << frames << " frames " << anim.width() << "x" << anim.height()
+		<< ", " << fileSize(animFile) << " bytes" << std::endl;
+	std::cout << "  BMP frames  : " << bmpBytes << " bus bytes, " << bmpTime << " uS per loop" << std::endl;
+	std::cout << "  Delta frames: " << anim.loopBusBytes() << " bus bytes, " << animTime << " uS per loop" << std::endl;
+	myTFT.playAnimation(x, y, anim, 5);
+	delayMilliSecRVL(TEST_DELAY1);
+}
+
+/*!
+ *@brief Draw an image file TEST_PASSES times
+ *@param path image file
+ *@param draw drawing method for the file format
+ *@return average uS per draw, -1 on error
+*/
+int64_t timeDraws(const char* path, rvlDisplay_Return_Codes_e (ST7789_TFT::*draw)(int16_t, int16_t, const char*))
+{
+	int64_t start = getTime();
+	for (uint16_t pass = 0; pass < TEST_PASSES; pass++)
+	{
+		if ((myTFT.*draw)(0, 0, path) != rvlDisplay_Success) return -1;
+	}
+	return (getTime() - start) / TEST_PASSES;
+}
+
+/*!
+ *@brief Draw a 24 bit BMP file the way the earlier examples do, whole file
+ *	read into memory then drawBitmap24
+ *@param x X coordinate
+ *@param y Y coordinate
+ *@param path 24 bit bottom up BMP file, rows a multiple of 4 bytes
+ *@return rvlDisplay_Success, or an error code
+*/
+rvlDisplay_Return_Codes_e drawBMP24(int16_t x, int16_t y, const char* path)
+{
+	FILE *pFile = fopen(path, "rb");
+	if (pFile == nullptr) return rvlDisplay_FileOpen;
+	uint8_t header[54];
+	if (fread(header, 1, sizeof(header), pFile) != sizeof(header) || header[0] != 'B' || header[1] != 'M' || header[28] != 24)
+	{
+		fclose(pFile);
+		return rvlDisplay_FileFormat;
+	}
+	uint32_t offset = header[10] | (header[11] << 8) | (header[12] << 16) | (header[13] << 24);
+	uint16_t w = header[18] | (header[19] << 8);
+	uint16_t h = header[22] | (header[23] << 8);
+	size_t size = (size_t)w * h * 3;
+	uint8_t* bmpBuffer = (uint8_t*)malloc(size);
+	if (bmpBuffer == nullptr)
+	{
+		fclose(pFile);
+		return rvlDisplay_MallocError;
+	}
+	rvlDisplay_Return_Codes_e returnCode = rvlDisplay_FileRead;
+	if (fseek(pFile, offset, SEEK_SET) == 0 && fread(bmpBuffer, 1, size, pFile) == size)
+		returnCode = myTFT.drawBitmap24(x, y, bmpBuffer, w, h);
+	free(bmpBuffer);
+	fclose(pFile);
+	return returnCode;
+}
+
+/*!
+ *@brief Draw a 24 bit BMP file with drawBMP24 TEST_PASSES times
+ *@param path image file
+ *@return average uS per draw, -1 on error
+*/
+int64_t timeBMP24Draws(const char* path)
+{
+	int64_t start = getTime();
+	for (uint16_t pass = 0; pass < TEST_PASSES; pass++)
+	{
+		if (drawBMP24(0, 0, path) != rvlDisplay_Success) return -1;
+	}
+	return (getTime() - start) / TEST_PASSES;
+}
+
+/*!
+ *@brief Draw a JPEG file at one scale TEST_PASSES times
+ *@param path image file
+ *@param scale decode scale
+ *@return average uS per draw, -1 on error
+*/
+int64_t timeJPEGDraws(const char* path, jpegDecoder::JPEGScale_e scale)
+{
+	int64_t start = getTime();
+	for (uint16_t pass = 0; pass < TEST_PASSES; pass++)
+	{
+		if (myTFT.drawJPEGFile(0, 0, path, scale) != rvlDisplay_Success) return -1;
+	}
+	return (getTime() - start) / TEST_PASSES;
+}
+
+long fileSize(const char* path) {
+	struct stat st;
+	if (stat(path, &st) != 0) return -1;
+	return st.st_size;
+}
+
+void EndTests(void)
+{
+	char teststr1[] = "Tests over";
+	myTFT.setFont(font_orla);
+	myTFT.fillScreen(RVLC_BLACK);
+	myTFT.writeCharString(35, 50, teststr1);
+	delayMilliSecRVL(TEST_DELAY5);
+	myTFT.TFTPowerDown(); // Power down device
+	bcm2835_close(); // Close the bcm2835 library
+	std::cout << "TFT End" << std::endl;
+}
+
+int64_t getTime() {
+	struct timespec tms;
+	if (clock_gettime(CLOCK_REALTIME,&tms)) return -1;
+	int64_t micros = tms.tv_sec * 1000000;
+	micros += tms.tv_nsec/1000;
+	if (tms.tv_nsec % 1000 >= 500) ++micros;
+	return micros;
+}
+
+// *************** EOF ****************
@@ -371,6 +371,12 @@ void Test902(void) {
 	{
 		std::cout << "Warning : Test TFTfillRectangle, An error occurred returnValue =" << +returnValue << std::endl;
 	}
+	// wholly off screen, nothing drawn
+	returnValue = myTFT.fillRectangle(-40, 25, 20, 20, RVLC_YELLOW);
+	if (returnValue != rvlDisplay_ShapeScreenBounds)
+	{
+		std::cout << "Warning : Test TFTfillRectangle, off screen rectangle not reported returnValue =" << +returnValue << std::endl;
+	}
 	myTFT.fillRect(165, 25, 20, 20, RVLC_GREEN);
 	myTFT.drawRoundRect(35, 60, 50, 50, 5, RVLC_CYAN);
 	myTFT.fillRoundRect(115, 60, 50, 50, 10, RVLC_WHITE);
@@ -0,0 +1,401 @@
+/*!
+	@file examples/st7789/Text_speed_test/main.cpp
+	@brief Text speed test. Characters per second for each font
+	@note See USER OPTIONS 1-3 in SETUP function
+	@details Each font fills the screen with characters TEST_PASSES times
+		and the characters per second are printed to console.
+	@test
+		-# Test 614 writeChar characters per second, each font
+		-# Test 615 writeCharString and print label refreshes per second
+		-# Test 616 Test 615 again with a glyph cache attached, hit rate
+		-# Test 617 Transparent text over a background against opaque text, each font
+		-# Test 618 Proportional fonts against fixed width fonts, same text
+		-# Test 619 Scaled text, default font at 1x to 4x against the SixteenSeg font
+		-# Test 620 Text grid, one changed digit redrawn against redrawing every line
+*/
+
+// Section ::  libraries
+#include <bcm2835.h> // for SPI GPIO and delays.
+#include <ctime> // for test timing
+#include "ST7789_TFT_LCD_RVL.hpp"
+
+// Section :: Defines
+//  Test related defines
+#define TEST_DELAY1 1000
+#define TEST_DELAY5 5000
+#define TEST_PASSES 5 // screens of characters for each font
+#define TEST_LABELS 1000 // label refreshes for each test
+#define GLYPH_CACHE_BYTES 65536 // glyph cache budget for Test 616
+
+// Section :: Globals
+ST7789_TFT myTFT;
+// Display size in pixels
+#define myTFTWidth 240
+#define myTFTHeight 320
+
+// Fonts to test and their names
+const display_Font_name_e fonts[] = {
+	font_default, font_pico, font_sevenSeg, font_thick, font_wide,
+	font_sinclairS, font_retro, font_mega, font_arialBold, font_hallfetica,
+	font_orla, font_arialRound, font_groTesk, font_mint, font_sixteenSeg
+};
+const char* fontNames[] = {
+	"Default", "Pico", "SevenSeg", "Thick", "Wide",
+	"SinclairS", "Retro", "Mega", "ArialBold", "Hallfetica",
+	"Orla", "ArialRound", "GroTesk", "Mint", "SixteenSeg"
+};
+// Character width and height of each font, in pixels
+const uint8_t fontSizes[][2] = {
+	{6, 8}, {4, 6}, {5, 8}, {8, 8}, {9, 8},
+	{8, 8}, {8, 16}, {16, 16}, {16, 16}, {16, 16},
+	{16, 24}, {16, 24}, {16, 32}, {24, 32}, {32, 48}
+};
+const uint8_t numberOfFonts = 15;
+
+//  Section ::  Function Headers
+
+int8_t Setup(void); // setup + user options
+void Test614(void); // writeChar per font
+void Test615(void); // writeCharString and print labels
+void Test616(void); // labels with glyph cache
+void Test617(void); // transparent text
+void Test618(void); // proportional fonts
+void Test619(void); // scaled text
+void Test620(void); // text grid
+void EndTests(void);
+
+int64_t getTime(); // Utility for timing
+
+//  Section ::  MAIN loop
+
+int main(void)
+{
+	if(Setup() != 0)return -1;
+	myTFT.TFTsetRotation(myTFT.TFT_Degrees_0);
+	Test614();
+	Test615();
+	Test616();
+	Test617();
+	Test618();
+	Test619();
+	Test620();
+	EndTests();
+	return 0;
+}
+// *** End OF MAIN **
+
+
+//  Section ::  Function Space
+
+int8_t Setup(void)
+{
+	std::cout << "TFT Start Test 614 text speed" << std::endl;
+	if(!bcm2835_init())
+	{
+		std::cout << "Error 1201 Problem with init bcm2835 library" << std::endl;
+		return 2;
+	}
+
+// ** USER OPTION 1 GPIO/SPI TYPE HW OR SW **
+	int8_t RST_TFT  =  25;
+	int8_t DC_TFT   =  24;
+	myTFT.TFTSetupGPIO(RST_TFT, DC_TFT);
+//*********************************************
+
+// ** USER OPTION 2 Screen Setup **
+	uint8_t OFFSET_COL = 0;  // 2, These offsets can be adjusted for any issues->
+	uint8_t OFFSET_ROW = 0; // 3, with manufacture tolerance/defects
+	myTFT.TFTInitScreenSize(OFFSET_COL, OFFSET_ROW ,myTFTWidth , myTFTHeight);
+// ***********************************
+
+// ** USER OPTION 3  SPI baud rate + SPI_CE_PIN**
+	uint32_t SCLK_FREQ =  8000000 ; // HW Spi freq in Hertz , MAX 125 Mhz MIN 30Khz
+	uint8_t SPI_CE_PIN = 0; // which HW SPI chip enable pin to use,  0 or 1
+	if(myTFT.TFTInitSPI( SCLK_FREQ, SPI_CE_PIN) != rvlDisplay_Success)
+	{
+		bcm2835_close(); //Close lib & /dev/mem, deallocating mem
+		return 3;
+	}
+//*****************************
+	std::cout << "ST7789 library version : " << GetRVLibVersionNum()<< std::endl;
+	std::cout <<"bcm2835 library version :" << bcm2835_version() << std::endl;
+	delayMilliSecRVL(50);
+	return 0;
+}
+
+/*!
+ *@brief writeChar characters per second for each font, the screen is
+ *	filled with characters from the font's own range TEST_PASSES times
+*/
+void Test614(void) {
+	myTFT.setTextColor(RVLC_WHITE, RVLC_BLUE);
+	for (uint8_t i = 0; i < numberOfFonts; i++)
+	{
+		myTFT.setFont(fonts[i]);
+		myTFT.fillScreen(RVLC_BLACK);
+		const uint8_t fontW = fontSizes[i][0], fontH = fontSizes[i][1];
+		const char first = (fonts[i] == font_sevenSeg || fonts[i] == font_sixteenSeg) ? '0' : 'A';
+		uint32_t chars = 0;
+		int64_t start = getTime();
+		for (uint16_t pass = 0; pass < TEST_PASSES; pass++)
+		{
+			char value = first;
+			for (int16_t y = 0; y + fontH <= myTFTHeight; y += fontH)
+			{
+				for (int16_t x = 0; x + fontW <= myTFTWidth; x += fontW)
+				{
+					if (myTFT.writeChar(x, y, value) != rvlDisplay_Success)
+					{
+						std::cout << "Error Test 614 : writeChar failed, font " << fontNames[i] << std::endl;
+						return;
+					}
+					chars++;
+					if (++value > first + 9) value = first;
+				}
+			}
+		}
+		int64_t duration = getTime() - start;
+		std::cout << fontNames[i] << " " << +fontW << "x" << +fontH << " : "
+			<< (duration > 0 ? chars * 1000000LL / duration : 0) << " chars/s" << std::endl;
+		delayMilliSecRVL(TEST_DELAY1);
+	}
+}
+
+/*!
+ *@brief Label refreshes per second, a line of text and numbers redrawn in place,
+ *	each label is sent as one run, one address window
+*/
+void Test615(void) {
+	myTFT.setFont(font_arialBold);
+	myTFT.setTextColor(RVLC_YELLOW, RVLC_BLACK);
+	myTFT.fillScreen(RVLC_BLACK);
+	char label[] = "Temp 23.5C Hum 41%";
+
+	int64_t start = getTime();
+	for (uint16_t i = 0; i < TEST_LABELS; i++)
+		myTFT.writeCharString(0, 40, label);
+	int64_t duration = getTime() - start;
+	std::cout << "writeCharString 18 chars : " << (duration > 0 ? TEST_LABELS * 1000000LL / duration : 0) << " labels/s" << std::endl;
+
+	start = getTime();
+	for (uint16_t i = 0; i < TEST_LABELS; i++)
+	{
+		myTFT.setCursor(0, 80);
+		myTFT.print(100000 + i);
+	}
+	duration = getTime() - start;
+	std::cout << "print(int) 6 digits : " << (duration > 0 ? TEST_LABELS * 1000000LL / duration : 0) << " labels/s" << std::endl;
+
+	start = getTime();
+	for (uint16_t i = 0; i < TEST_LABELS; i++)
+	{
+		myTFT.setCursor(0, 120);
+		myTFT.print(-1.0 * i / 7.0, 3);
+	}
+	duration = getTime() - start;
+	std::cout << "print(double) 3 places : " << (duration > 0 ? TEST_LABELS * 1000000LL / duration : 0) << " labels/s" << std::endl;
+	delayMilliSecRVL(TEST_DELAY5);
+}
+
+/*!
+ *@brief Test 615 with a glyph cache attached, each glyph is rendered once
+ *	and later sent from the cache with no bit unpacking
+*/
+void Test616(void) {
+	glyphCache cache(GLYPH_CACHE_BYTES);
+	myTFT.setGlyphCache(&cache);
+	std::cout << "Glyph cache " << GLYPH_CACHE_BYTES << " bytes" << std::endl;
+	Test615();
+	rvlGlyphCache_Stats_t stats = cache.getStats();
+	std::cout << "Glyph cache hits " << stats.hits << " misses " << stats.misses
+		<< " glyphs " << stats.entries << " bytes " << stats.bytesUsed << std::endl;
+	myTFT.setGlyphCache(nullptr);
+}
+
+/*!
+ *@brief Transparent text, only the glyph pixels are sent, over colored bars,
+ *	against opaque text which paints the whole character cell
+*/
+void Test617(void) {
+	const uint16_t bars[] = {RVLC_RED, RVLC_GREEN, RVLC_BLUE, RVLC_MAGENTA};
+	myTFT.setTextColor(RVLC_WHITE, RVLC_BLACK);
+	for (uint8_t i = 0; i < numberOfFonts; i++)
+	{
+		myTFT.setFont(fonts[i]);
+		const uint8_t fontW = fontSizes[i][0], fontH = fontSizes[i][1];
+		for (uint8_t b = 0; b < 4; b++)
+			myTFT.fillRect(0, b * (myTFTHeight / 4), myTFTWidth, myTFTHeight / 4, bars[b]);
+		char line[64];
+		const uint8_t lineLength = std::min<uint8_t>(myTFTWidth / fontW, sizeof(line) - 1);
+		const char first = (fonts[i] == font_sevenSeg || fonts[i] == font_sixteenSeg) ? '0' : 'A';
+		for (uint8_t c = 0; c < lineLength; c++) line[c] = first + (c % 10);
+		line[lineLength] = '\0';
+		int64_t rate[2];
+		for (uint8_t transparent = 0; transparent < 2; transparent++)
+		{
+			myTFT.setTextTransparent(transparent);
+			uint32_t chars = 0;
+			int64_t start = getTime();
+			for (uint16_t pass = 0; pass < TEST_PASSES; pass++)
+			{
+				for (int16_t y = transparent * fontH; y + fontH <= myTFTHeight; y += 2 * fontH)
+				{
+					myTFT.writeCharString(0, y, line);
+					chars += lineLength;
+				}
+			}
+			int64_t duration = getTime() - start;
+			rate[transparent] = (duration > 0) ? chars * 1000000LL / duration : 0;
+		}
+		myTFT.setTextTransparent(false);
+		std::cout << fontNames[i] << " opaque : " << rate[0] << " chars/s, transparent : "
+			<< rate[1] << " chars/s" << std::endl;
+		delayMilliSecRVL(TEST_DELAY1);
+	}
+}
+
+/*!
+ *@brief Proportional fonts against the fixed width fonts of the same height,
+ *	the same text in each, pixels sent per string and strings per second
+*/
+void Test618(void) {
+	const display_Font_name_e fixedFonts[] = {font_default, font_arialBold};
+	const display_Font_name_e propFonts[] = {font_defaultProp, font_arialBoldProp};
+	const char* names[] = {"Default", "ArialBold"};
+	char text[] = "Mill 11.1 Wait";
+	myTFT.setTextColor(RVLC_WHITE, RVLC_BLACK);
+	myTFT.fillScreen(RVLC_BLACK);
+	for (uint8_t i = 0; i < 2; i++)
+	{
+		int64_t rate[2];
+		uint32_t pixels[2];
+		for (uint8_t prop = 0; prop < 2; prop++)
+		{
+			myTFT.setFont(prop ? propFonts[i] : fixedFonts[i]);
+			const int16_t y = 40 + i * 80 + prop * 30;
+			pixels[prop] = myTFT.getTextWidth(text) * (i ? 16 : 8);
+			int64_t start = getTime();
+			for (uint16_t n = 0; n < TEST_LABELS; n++)
+			{
+				if (myTFT.writeCharString(0, y, text) != rvlDisplay_Success)
+				{
+					std::cout << "Error Test 618 : writeCharString failed, font " << names[i] << std::endl;
+					return;
+				}
+			}
+			int64_t duration = getTime() - start;
+			rate[prop] = (duration > 0) ? TEST_LABELS * 1000000LL / duration : 0;
+		}
+		std::cout << names[i] << " fixed : " << pixels[0] << " pixels " << rate[0] << " strings/s, proportional : "
+			<< pixels[1] << " pixels " << rate[1] << " strings/s" << std::endl;
+	}
+	myTFT.setFont(font_default);
+	delayMilliSecRVL(TEST_DELAY5);
+}
+
+/*!
+ *@brief Scaled text, a reading in the default font at scale 1 to 4, each
+ *	label one address window, against the 32x48 SixteenSeg font
+*/
+void Test619(void) {
+	char reading[] = "12:45";
+	myTFT.setTextColor(RVLC_GREEN, RVLC_BLACK);
+	myTFT.fillScreen(RVLC_BLACK);
+	int16_t y = 0;
+	for (uint8_t scale = 1; scale <= 5; scale++)
+	{
+		// scale 5 is the SixteenSeg font at normal size
+		const bool sixteenSeg = (scale == 5);
+		myTFT.setFont(sixteenSeg ? font_sixteenSeg : font_default);
+		myTFT.setTextScale(sixteenSeg ? 1 : scale);
+		int64_t start = getTime();
+		for (uint16_t n = 0; n < TEST_LABELS; n++)
+		{
+			if (myTFT.writeCharString(0, y, reading) != rvlDisplay_Success)
+			{
+				std::cout << "Error Test 619 : writeCharString failed, scale " << +scale << std::endl;
+				myTFT.setTextScale(1);
+				return;
+			}
+		}
+		int64_t duration = getTime() - start;
+		std::cout << (sixteenSeg ? "SixteenSeg" : "Default") << " scale " << +myTFT.getTextScale() << " width "
+			<< myTFT.getTextWidth(reading) << " : " << (duration > 0 ? TEST_LABELS * 1000000LL / duration : 0)
+			<< " labels/s" << std::endl;
+		y += sixteenSeg ? 48 : 8 * scale + 4;
+	}
+	myTFT.setTextScale(1);
+	myTFT.setFont(font_default);
+	delayMilliSecRVL(TEST_DELAY5);
+}
+
+/*!
+ *@brief A screen of status lines in a text grid, a counter in one line changes
+ *	each update and only its changed digits are sent, against redrawing
+ *	every line with writeCharString
+*/
+void Test620(void) {
+	const uint8_t cols = myTFTWidth / 6, rows = myTFTHeight / 8;
+	textGrid grid(myTFT, 0, 0, cols, rows, font_default);
+	char line[64];
+	grid.setColor(RVLC_WHITE, RVLC_BLACK);
+	for (uint8_t row = 0; row < rows; row++)
+	{
+		snprintf(line, sizeof(line), "Line %02u status OK", row);
+		grid.print(0, row, line);
+	}
+	grid.update();
+
+	uint32_t cells = 0;
+	int64_t start = getTime();
+	for (uint16_t i = 0; i < TEST_LABELS; i++)
+	{
+		snprintf(line, sizeof(line), "%05u", i);
+		grid.print(20, rows / 2, line);
+		grid.update();
+		cells += grid.getCellsDrawn();
+	}
+	int64_t duration = getTime() - start;
+	std::cout << "Text grid " << +cols << "x" << +rows << " one counter : "
+		<< (duration > 0 ? TEST_LABELS * 1000000LL / duration : 0) << " updates/s, "
+		<< cells / TEST_LABELS << " cells per update" << std::endl;
+
+	myTFT.setFont(font_default);
+	myTFT.setTextColor(RVLC_WHITE, RVLC_BLACK);
+	start = getTime();
+	for (uint16_t i = 0; i < TEST_LABELS / 10; i++)
+	{
+		for (uint8_t row = 0; row < rows; row++)
+		{
+			if (row == rows / 2)
+				snprintf(line, sizeof(line), "Line %02u status OK  %05u", row, i);
+			else
+				snprintf(line, sizeof(line), "Line %02u status OK", row);
+			myTFT.writeCharString(0, row * 8, line);
+		}
+	}
+	duration = getTime() - start;
+	std::cout << "Redraw every line : " << (duration > 0 ? (TEST_LABELS / 10) * 1000000LL / duration : 0)
+		<< " updates/s" << std::endl;
+	delayMilliSecRVL(TEST_DELAY5);
+}
+
+void EndTests(void)
+{
+	char teststr1[] = "Tests over";
+	myTFT.setFont(font_orla);
+	myTFT.fillScreen(RVLC_BLACK);
+	myTFT.writeCharString(35, 50, teststr1);
+	delayMilliSecRVL(TEST_DELAY5);
+	myTFT.TFTPowerDown(); // Power down device
+	bcm2835_close(); // Close the bcm2835 library
+	std::cout << "TFT End" << std::endl;
+}
+
+int64_t getTime() {
+	struct timespec tms;
+	if (clock_gettime(CLOCK_MONOTONIC,&tms)) return -1;
+	int64_t micros = tms.tv_sec * 1000000;
+	micros += tms.tv_nsec/1000;
+	return micros;
+}
@@ -0,0 +1,144 @@
+/*!
+	@file examples/st7789/Video_player/main.cpp
+	@brief Video player test. Plays raw big endian RGB565 frames from stdin or a file
+	@note See USER OPTIONS 1-3 in SETUP function
+	@details Frames are 240x320, full screen, rows top down, no header, e.g.
+		ffmpeg -i clip.mp4 -vf scale=240:320 -f rawvideo -pix_fmt rgb565be - | sudo ./Bin/test.out
+		sudo ./Bin/test.out clip.raw 25
+		Usage: test.out [file, - or none for stdin] [frames per second, 0 = as fast as possible]
+		Frames later than one frame period are dropped. Ctrl-C stops playback.
+		Frames per second achieved, dropped frames and latency (frame read to frame
+		sent) are printed at the end.
+	@test
+		-# Test 611 Raw RGB565 video from stdin or a file
+*/
+
+// Section ::  libraries
+#include <bcm2835.h> // for SPI GPIO and delays.
+#include <csignal> // for Ctrl-C
+#include <cstdlib> // for atof
+#include <cstring> // for strcmp
+#include <fcntl.h> // for open
+#include <unistd.h> // for close
+#include "ST7789_TFT_LCD_RVL.hpp"
+
+// Section :: Defines
+//  Test related defines
+#define TEST_DELAY5 5000
+#define DEFAULT_FPS 30.0f
+
+// Section :: Globals
+ST7789_TFT myTFT;
+// Display size in pixels
+#define myTFTWidth 240
+#define myTFTHeight 320
+videoPlayer myPlayer(myTFTWidth, myTFTHeight);
+
+//  Section ::  Function Headers
+
+int8_t Setup(void); // setup + user options
+void Test611(int fd, float fps); // play video
+void EndTests(void);
+void stopPlayer(int); // Ctrl-C handler
+
+//  Section ::  MAIN loop
+
+int main(int argc, char* argv[])
+{
+	int fd = 0; // stdin
+	if (argc > 1 && strcmp(argv[1], "-") != 0)
+	{
+		fd = open(argv[1], O_RDONLY);
+		if (fd < 0)
+		{
+			std::cout << "Error 1202 could not open " << argv[1] << std::endl;
+			return -1;
+		}
+	}
+	float fps = (argc > 2) ? atof(argv[2]) : DEFAULT_FPS;
+	if(Setup() != 0)return -1;
+	myTFT.TFTsetRotation(myTFT.TFT_Degrees_0);
+	signal(SIGINT, stopPlayer);
+	Test611(fd, fps);
+	if (fd != 0) close(fd);
+	EndTests();
+	return 0;
+}
+// *** End OF MAIN **
+
+
+//  Section ::  Function Space
+
+int8_t Setup(void)
+{
+	std::cout << "TFT Start Test 611 video player" << std::endl;
+	if(!bcm2835_init())
+	{
+		std::cout << "Error 1201 Problem with init bcm2835 library" << std::endl;
+		return 2;
+	}
+
+// ** USER OPTION 1 GPIO/SPI TYPE HW OR SW **
+	int8_t RST_TFT  =  25;
+	int8_t DC_TFT   =  24;
+	myTFT.TFTSetupGPIO(RST_TFT, DC_TFT);
+//*********************************************
+
+// ** USER OPTION 2 Screen Setup **
+	uint8_t OFFSET_COL = 0;  // 2, These offsets can be adjusted for any issues->
+	uint8_t OFFSET_ROW = 0; // 3, with manufacture tolerance/defects
+	myTFT.TFTInitScreenSize(OFFSET_COL, OFFSET_ROW ,myTFTWidth , myTFTHeight);
+// ***********************************
+
+// ** USER OPTION 3  SPI baud rate + SPI_CE_PIN**
+	uint32_t SCLK_FREQ =  8000000 ; // HW Spi freq in Hertz , MAX 125 Mhz MIN 30Khz
+	uint8_t SPI_CE_PIN = 0; // which HW SPI chip enable pin to use,  0 or 1
+	if(myTFT.TFTInitSPI( SCLK_FREQ, SPI_CE_PIN) != rvlDisplay_Success)
+	{
+		bcm2835_close(); //Close lib & /dev/mem, deallocating mem
+		return 3;
+	}
+//*****************************
+	std::cout << "ST7789 library version : " << GetRVLibVersionNum()<< std::endl;
+	std::cout <<"bcm2835 library version :" << bcm2835_version() << std::endl;
+	delayMilliSecRVL(50);
+	return 0;
+}
+
+/*!
+ *@brief Play raw RGB565 frames, each frame one address window and one SPI write
+ *@param fd file descriptor to read frames from
+ *@param fps target frames per second, 0 for as fast as possible
+*/
+void Test611(int fd, float fps) {
+	myTFT.fillScreen(RVLC_BLACK);
+	rvlDisplayFrameSink sink(myTFT, 0, 0);
+	std::cout << "Playing " << myTFTWidth << "x" << myTFTHeight << " frames, "
+		<< myPlayer.frameBytes() << " bytes each, target " << fps << " fps" << std::endl;
+	if (myPlayer.play(fd, sink, fps) != rvlDisplay_Success)
+		std::cout << "Error Test 611 : playback stopped on error" << std::endl;
+	const rvlVideo_Stats_t& stats = myPlayer.getStats();
+	std::cout << "Frames read    : " << stats.framesRead << std::endl;
+	std::cout << "Frames shown   : " << stats.framesShown << std::endl;
+	std::cout << "Frames dropped : " << stats.framesDropped << std::endl;
+	std::cout << "Frames/second  : " << stats.fps << std::endl;
+	std::cout << "Latency uS     : min " << stats.latencyMinUs << ", avg "
+		<< stats.latencyAvgUs << ", max " << stats.latencyMaxUs << std::endl;
+}
+
+void stopPlayer(int)
+{
+	myPlayer.stop();
+}
+
+void EndTests(void)
+{
+	char teststr1[] = "Tests over";
+	myTFT.setFont(font_orla);
+	myTFT.fillScreen(RVLC_BLACK);
+	myTFT.writeCharString(35, 50, teststr1);
+	delayMilliSecRVL(TEST_DELAY5);
+	myTFT.TFTPowerDown(); // Power down device
+	bcm2835_close(); // Close the bcm2835 library
+	std::cout << "TFT End" << std::endl;
+}
@@ -0,0 +1,82 @@
+/*!
+	@file     asset_bundle_RVL.hpp
+	@author   Gavin Lyons
+	@brief    Memory mapped bundle of images stored in panel native format.
+				Project Name: ST7789_TFT_RPI
+	@details  A bundle file is made at build time by the rvl_bundle tool (make tools)
+				from directories of BMP files. Image data is stored as big endian
+				RGB565, rows top down, so it is sent to the display as is.
+				File layout, all header fields little endian:
+				-# rvlBundle_Header_t
+				-# rvlBundle_Entry_t x count, sorted by name
+				-# image data, each image starting on a 4 byte boundary
+*/
+
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include "common_data_RVL.hpp"
+
+#define RVL_BUNDLE_MAGIC "RVLB"    /**< First four bytes of a bundle file */
+#define RVL_BUNDLE_VERSION 1       /**< Bundle format version */
+#define RVL_BUNDLE_NAME_SIZE 24    /**< Bytes for an entry name including null terminator */
+
+/*! @brief Bundle file header */
+struct rvlBundle_Header_t
+{
+	char magic[4];      /**< RVL_BUNDLE_MAGIC */
+	uint16_t version;   /**< RVL_BUNDLE_VERSION */
+	uint16_t count;     /**< Number of images */
+};
+
+/*! @brief Bundle index entry, one per image */
+struct rvlBundle_Entry_t
+{
+	char name[RVL_BUNDLE_NAME_SIZE]; /**< Image name, file name without extension */
+	uint16_t width;     /**< Width in pixels */
+	uint16_t height;    /**< Height in pixels */
+	uint32_t offset;    /**< File offset of image data, width*height*2 bytes */
+};
+
+static_assert(sizeof(rvlBundle_Header_t) == 8, "bundle header layout");
+static_assert(sizeof(rvlBundle_Entry_t) == 32, "bundle entry layout");
+
+/*! @brief One image in an open bundle, data points into the mapping */
+struct rvlAsset_t
+{
+	const char* name;     /**< Image name */
+	uint16_t width;       /**< Width in pixels */
+	uint16_t height;      /**< Height in pixels */
+	const uint8_t* data;  /**< Big endian RGB565 pixels, rows top down */
+};
+
+/*!
+	@brief Class to open a bundle file and look up its images
+*/
+class assetBundle {
+
+ public:
+
+	assetBundle(){};
+	~assetBundle();
+	assetBundle(const assetBundle&) = delete;
+	assetBundle& operator=(const assetBundle&) = delete;
+
+	rvlDisplay_Return_Codes_e open(const char* path);
+	void close(void);
+	const rvlAsset_t* find(const char* name) const;
+	const rvlAsset_t* at(uint16_t index) const;
+
+	bool isOpen(void) const { return _pMap != nullptr; } /**< @return true if a bundle is mapped */
+	uint16_t count(void) const { return _count; }        /**< @return number of images */
+
+ private:
+
+	const uint8_t* _pMap = nullptr; /**< Read only mapping of the whole file */
+	size_t _mapSize = 0;            /**< Size of the mapping in bytes */
+	uint16_t _count = 0;            /**< Number of images */
+	rvlAsset_t* _assets = nullptr;  /**< Index built at open, sorted by name */
+};
+
+// ********************** EOF *********************
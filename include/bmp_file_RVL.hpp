@@ -0,0 +1,71 @@
+/*!
+	@file     bmp_file_RVL.hpp
+	@author   Gavin Lyons
+	@brief    Streaming reader for Windows BMP image files. Project Name: ST7789_TFT_RPI
+	@details  Parses the file header and returns rows in display order (top down)
+				already converted to big endian RGB565. Only the rows asked for
+				are read, through a fixed buffer, so the whole image is never held
+				in memory. 16 bit (565 and 555), 24 bit and 32 bit uncompressed
+				images, bottom up or top down, with any row padding.
+*/
+
+#pragma once
+
+#include <cstdio>
+#include <cstdint>
+#include "common_data_RVL.hpp"
+
+#define RVL_BMP_READ_BUFFER_SIZE 8192 /**< Size in bytes of the bmpReader file read buffer */
+
+/*!
+	@brief Class to read a BMP file a band of rows at a time
+*/
+class bmpReader {
+
+ public:
+
+	/*! Pixel formats the reader can convert from */
+	enum BMPFormat_e : uint8_t
+	{
+		BMP_None = 0,     /**< No file open */
+		BMP_RGB565 = 1,   /**< 16 bit, 5-6-5 bitfields */
+		BMP_RGB555 = 2,   /**< 16 bit, 5-5-5, default for 16 bit BI_RGB */
+		BMP_BGR888 = 3,   /**< 24 bit */
+		BMP_BGRA8888 = 4  /**< 32 bit, alpha or unused byte ignored */
+	};
+
+	bmpReader(){};
+	~bmpReader();
+	bmpReader(const bmpReader&) = delete;
+	bmpReader& operator=(const bmpReader&) = delete;
+
+	rvlDisplay_Return_Codes_e open(const char* path);
+	void close(void);
+	rvlDisplay_Return_Codes_e readRows(uint16_t row, uint16_t rows, uint16_t x, uint16_t w, uint8_t* pDst);
+
+	bool isOpen(void) const { return _pFile != nullptr; }   /**< @return true if a file is open */
+	uint16_t width(void) const { return _width; }           /**< @return image width in pixels */
+	uint16_t height(void) const { return _height; }         /**< @return image height in pixels */
+	uint8_t bitsPerPixel(void) const { return _bitsPerPixel; } /**< @return 16, 24 or 32 */
+	BMPFormat_e format(void) const { return _format; }      /**< @return pixel format of the file */
+	uint32_t dataOffset(void) const { return _dataOffset; } /**< @return file offset of the first stored row */
+	uint32_t stride(void) const { return _stride; }         /**< @return bytes per stored row including padding */
+	bool topDown(void) const { return _topDown; }           /**< @return true if the first stored row is the top row */
+
+ private:
+
+	void convertRow(const uint8_t* pSrc, uint8_t* pDst, uint32_t pixels);
+	bool readAt(uint32_t offset, uint32_t len);
+
+	FILE* _pFile = nullptr;        /**< Open image file */
+	uint32_t _dataOffset = 0;      /**< File offset of the first stored row */
+	uint32_t _stride = 0;          /**< Bytes per stored row including padding */
+	uint16_t _width = 0;           /**< Image width in pixels */
+	uint16_t _height = 0;          /**< Image height in pixels */
+	uint8_t _bitsPerPixel = 0;     /**< 16, 24 or 32 */
+	bool _topDown = false;         /**< true if first stored row is the top of the image */
+	BMPFormat_e _format = BMP_None; /**< Pixel format */
+	uint8_t _readBuffer[RVL_BMP_READ_BUFFER_SIZE]; /**< Raw file data on its way to conversion */
+};
+
+// ********************** EOF *********************
@@ -12,13 +12,27 @@
 #include <cstdio>
 #include <cstdint>
 #include <cstdbool>
+#include <vector>
+#include <algorithm>
 #include <bcm2835.h> // Dependency
 #include "print_data_RVL.hpp"
 #include "font_data_RVL.hpp"
 #include "common_data_RVL.hpp"
+#include "pixel_convert_RVL.hpp"
+#include "bmp_file_RVL.hpp"
+#include "asset_bundle_RVL.hpp"
+#include "image_cache_RVL.hpp"
+#include "glyph_cache_RVL.hpp"
+#include "rle565_RVL.hpp"
+#include "qoi_RVL.hpp"
+#include "jpeg_RVL.hpp"
+#include "video_player_RVL.hpp"
+#include "delta_anim_RVL.hpp"
 
 // defines 
 #define _swap_int16_t_RVL(a, b) { int16_t t; t = a; a = b; b = t;}
+#define RVL_SCRATCH_BUFFER_SIZE 4096 /**< Size in bytes of the SPI scratch buffer, must be even */
+#define RVL_CLIP_STACK_DEPTH 8 /**< Maximum number of nested clip rectangles */
 
 // GPIO abstraction 
 #define DisplayRVL_DC_SetHigh  bcm2835_gpio_write(_DisplayRVL_DC, HIGH)
@@ -64,6 +78,23 @@
 #define RVLC_GYELLOW 0xAFE5
 #define RVLC_PINK    0xFC18
 
+/*! @brief One horizontal run of pixels, used by the span fill engine */
+struct rvlDisplay_Span_t
+{
+	int16_t x; /**< Start column of span */
+	int16_t y; /**< Row of span */
+	int16_t w; /**< Width of span in pixels */
+};
+
+/*! @brief A clip rectangle, corner co-ordinates are inclusive */
+struct rvlDisplay_Clip_t
+{
+	int16_t x0; /**< Left column */
+	int16_t y0; /**< Top row */
+	int16_t x1; /**< Right column */
+	int16_t y1; /**< Bottom row */
+};
+
 /*!
 	@brief Class to handle fonts and graphics of color 16 bit display
 */
@@ -79,19 +110,26 @@ class color16_graphics:public display_Fonts, public Print  {
 	virtual void setAddrWindow(uint16_t, uint16_t, uint16_t, uint16_t) = 0;
 	void fillScreen(uint16_t color);
 	void setCursor(int16_t x, int16_t y);
+	int16_t getCursorX(void);
+	int16_t getCursorY(void);
+
+	// Clipping
+	rvlDisplay_Return_Codes_e pushClipRect(int16_t x, int16_t y, uint16_t w, uint16_t h);
+	rvlDisplay_Return_Codes_e popClipRect(void);
+	void resetClipRect(void);
 	
 	// Shapes and lines
-	void drawPixel(uint16_t, uint16_t, uint16_t);
+	void drawPixel(int16_t, int16_t, uint16_t);
 	void drawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color);
-	rvlDisplay_Return_Codes_e drawFastVLine(uint16_t x, uint16_t y, uint16_t h, uint16_t color);
-	rvlDisplay_Return_Codes_e drawFastHLine(uint16_t x, uint16_t y, uint16_t w, uint16_t color);
+	rvlDisplay_Return_Codes_e drawFastVLine(int16_t x, int16_t y, uint16_t h, uint16_t color);
+	rvlDisplay_Return_Codes_e drawFastHLine(int16_t x, int16_t y, uint16_t w, uint16_t color);
 
-	void drawRectWH(uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t color);
-	rvlDisplay_Return_Codes_e fillRectangle(uint16_t, uint16_t, uint16_t, uint16_t, uint16_t);
-	void fillRect(uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t color);
+	void drawRectWH(int16_t x, int16_t y, uint16_t w, uint16_t h, uint16_t color);
+	rvlDisplay_Return_Codes_e fillRectangle(int16_t, int16_t, uint16_t, uint16_t, uint16_t);
+	void fillRect(int16_t x, int16_t y, uint16_t w, uint16_t h, uint16_t color);
 
-	void drawRoundRect(uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t r, uint16_t color);
-	void fillRoundRect(uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t r, uint16_t color);
+	void drawRoundRect(int16_t x, int16_t y, uint16_t w, uint16_t h, uint16_t r, uint16_t color);
+	void fillRoundRect(int16_t x, int16_t y, uint16_t w, uint16_t h, uint16_t r, uint16_t color);
 	
 	void drawCircle(int16_t x0, int16_t y0, int16_t r, uint16_t color);
 	void fillCircle(int16_t x0, int16_t y0, int16_t r, uint16_t color);
@@ -101,35 +139,76 @@ class color16_graphics:public display_Fonts, public Print  {
 
 	// Text related functions 
 	virtual size_t write(uint8_t) override;
+	virtual size_t write(const uint8_t *buffer, size_t size) override;
 	rvlDisplay_Return_Codes_e writeChar( int16_t x, int16_t y, char value );
 	rvlDisplay_Return_Codes_e writeCharString( int16_t x, int16_t y, char *text);
 	void setTextWrap(bool w);
+	void setTextTransparent(bool transparent);
+	bool getTextTransparent(void);
 	void setTextColor(uint16_t c, uint16_t bg);
 	void setTextColor(uint16_t c);
+	uint16_t getTextColor(void);
+	uint16_t getTextBgColor(void);
+	void setGlyphCache(glyphCache* cache);
 	
 	// Bitmap & Icon
-	rvlDisplay_Return_Codes_e drawIcon(uint16_t x, uint16_t y, uint16_t w, uint16_t color, uint16_t bgcolor, const unsigned char character[]);
-	rvlDisplay_Return_Codes_e drawBitmap(uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t color, uint16_t bgcolor, const uint8_t *pBmp);
-	rvlDisplay_Return_Codes_e drawBitmap24(uint16_t x, uint16_t y, uint8_t *pBmp, uint16_t w, uint16_t h);
-	rvlDisplay_Return_Codes_e drawBitmap16(uint16_t x, uint16_t y, uint8_t *pBmp, uint16_t w, uint16_t h);
+	rvlDisplay_Return_Codes_e drawIcon(int16_t x, int16_t y, uint16_t w, uint16_t color, uint16_t bgcolor, const unsigned char character[]);
+	rvlDisplay_Return_Codes_e drawBitmap(int16_t x, int16_t y, uint16_t w, uint16_t h, uint16_t color, uint16_t bgcolor, const uint8_t *pBmp);
+	rvlDisplay_Return_Codes_e drawBitmap24(int16_t x, int16_t y, uint8_t *pBmp, uint16_t w, uint16_t h);
+	rvlDisplay_Return_Codes_e drawBitmap16(int16_t x, int16_t y, uint8_t *pBmp, uint16_t w, uint16_t h, bool bigEndianTopDown = false);
+	rvlDisplay_Return_Codes_e drawBitmap565(int16_t x, int16_t y, const uint8_t *pData, uint16_t w, uint16_t h, uint32_t stride = 0);
+	rvlDisplay_Return_Codes_e drawBitmapFile(int16_t x, int16_t y, const char* path);
+	rvlDisplay_Return_Codes_e drawBitmapFile(int16_t x, int16_t y, bmpReader& bmp);
+	rvlDisplay_Return_Codes_e drawAsset(int16_t x, int16_t y, const rvlAsset_t* asset);
+	void setImageCache(imageCache* cache);
+	rvlDisplay_Return_Codes_e drawRLE565(int16_t x, int16_t y, const uint8_t* pData, size_t len);
+	rvlDisplay_Return_Codes_e drawRLE565File(int16_t x, int16_t y, const char* path);
+	rvlDisplay_Return_Codes_e drawRLE565(int16_t x, int16_t y, rle565Decoder& rle);
+	rvlDisplay_Return_Codes_e drawQOI(int16_t x, int16_t y, const uint8_t* pData, size_t len);
+	rvlDisplay_Return_Codes_e drawQOIFile(int16_t x, int16_t y, const char* path);
+	rvlDisplay_Return_Codes_e drawQOI(int16_t x, int16_t y, qoiDecoder& qoi);
+	rvlDisplay_Return_Codes_e drawJPEG(int16_t x, int16_t y, const uint8_t* pData, size_t len, jpegDecoder::JPEGScale_e scale = jpegDecoder::JPEG_Scale_1);
+	rvlDisplay_Return_Codes_e drawJPEGFile(int16_t x, int16_t y, const char* path, jpegDecoder::JPEGScale_e scale = jpegDecoder::JPEG_Scale_1);
+	rvlDisplay_Return_Codes_e drawJPEG(int16_t x, int16_t y, jpegDecoder& jpeg);
+	rvlDisplay_Return_Codes_e drawAnimationFrame(int16_t x, int16_t y, const deltaAnimation& anim, uint16_t frame);
+	rvlDisplay_Return_Codes_e playAnimation(int16_t x, int16_t y, const deltaAnimation& anim, uint16_t loops = 1);
 	// RGB to 565
 	int16_t Color565(int16_t ,int16_t , int16_t );
 protected:
 
 	void pushColor(uint16_t color);
+	void drawLineRun(bool steep, int16_t start, int16_t end, int16_t minor, uint16_t color);
 	void drawCircleHelper(int16_t x0, int16_t y0, int16_t r, uint8_t cornername, uint16_t color);
-	void fillCircleHelper(int16_t x0, int16_t y0, int16_t r, uint8_t cornername, int16_t delta, uint16_t color);
+	void roundRectSpans(int16_t x, int16_t y, int16_t w, int16_t h, int16_t r);
+	const uint8_t* cachedBitmap(const uint8_t* pBmp, uint16_t w, uint16_t h, uint8_t bitsPerPixel);
+	const rvlMono1LUT_t& mono1LUT(uint16_t color, uint16_t bgcolor);
+	void renderGlyph(char value, uint8_t* pDst, uint32_t stride, uint16_t color, uint16_t bgcolor);
+	const uint8_t* cachedGlyph(char value, uint16_t color, uint16_t bgcolor);
+	void glyphSpans(char value, int16_t x, int16_t y);
+	void scaleGlyph(const uint8_t* pSrc, uint8_t advance, uint8_t* pDst, uint32_t stride);
+	bool charInBounds(int16_t x, int16_t y);
+	uint16_t textRunLength(const uint8_t* pText, size_t len);
+	rvlDisplay_Return_Codes_e writeTextRun(int16_t x, int16_t y, const uint8_t* pText, uint16_t count);
+
+	// Clipping
+	bool clipWindow(int32_t& x0, int32_t& y0, int32_t& x1, int32_t& y1);
+
+	// Span engine
+	void fillSpans(const rvlDisplay_Span_t* spans, size_t count, uint16_t color);
+	bool fillRectWindow(int16_t x, int16_t y, int32_t w, int32_t h, uint16_t color);
+	void writeColorRepeat(uint16_t color, uint32_t count);
 	
 	void writeCommand(uint8_t);
 	void writeData(uint8_t);
 	void spiWrite(uint8_t);
 	void spiWriteSoftware(uint8_t spidata);
 
-	void spiWriteDataBuffer(uint8_t* spidata, uint32_t len);
+	void spiWriteDataBuffer(const uint8_t* spidata, uint32_t len);
 
 	bool _hardwareSPI=true; /**< True for Hardware SPI on , false fpr Software SPI on*/
 	
 	bool _textwrap = true;              /**< wrap text around the screen on overflow*/
+	bool _textTransparent = false;      /**< text draws glyph pixels only, background left as is*/
 	uint16_t _textcolor = 0xFFFF ;      /**< 16 bit ForeGround color for text*/
 	uint16_t _textbgcolor =0x0000 ;     /**< 16 bit BackGround color for text*/
 
@@ -149,7 +228,38 @@ protected:
 
 	uint16_t _HighFreqDelay = 0; /**< uS GPIO Communications delay, SW SPI ONLY */
 	uint8_t _TFT_SPI_Handle_Chosen = 0; /**< Which SPi interface handle to use 0 or 1(aux) */
+
+	uint8_t _scratchBuffer[RVL_SCRATCH_BUFFER_SIZE]; /**< Scratch buffer for pixel data on its way to SPI */
+	int32_t _scratchColor = -1; /**< Color the scratch buffer is pre-filled with, -1 if none */
+	uint32_t _scratchFilled = 0; /**< Number of pixels of _scratchColor at start of scratch buffer */
+	std::vector<rvlDisplay_Span_t> _spanList; /**< Spans of the shape being filled, reused between calls */
+	std::vector<int16_t> _cornerWidth; /**< Corner half width by row of the rounded shape being filled, reused between calls */
+	std::vector<uint8_t> _textStrip; /**< Rendered line of text on its way to SPI, reused between calls */
+	std::vector<uint8_t> _glyphBuffer; /**< One glyph at font size, before scaling, reused between calls */
+	std::vector<uint8_t> _jpegStrip; /**< JPEG MCU row too big for the scratch buffer, reused between calls */
+
+	rvlDisplay_Clip_t _clipStack[RVL_CLIP_STACK_DEPTH]; /**< Stack of clip rectangles, top is the active clip */
+	uint8_t _clipDepth = 0; /**< Number of clip rectangles on the stack, 0 = whole screen */
+
+	imageCache* _imageCache = nullptr; /**< Attached cache of converted images, not owned, nullptr for none */
+	glyphCache* _glyphCache = nullptr; /**< Attached cache of rendered glyphs, not owned, nullptr for none */
+	rvlMono1LUT_t _mono1LUT; /**< 1 bit bitmap expansion table for the last color pair used */
 private:
 
 };
+
+/*!
+	@brief Frame sink which sends videoPlayer frames to the display at a fixed position
+*/
+class rvlDisplayFrameSink : public rvlFrameSink {
+ public:
+	rvlDisplayFrameSink(color16_graphics& display, int16_t x = 0, int16_t y = 0) :
+		_display(display), _x(x), _y(y) {};
+	rvlDisplay_Return_Codes_e writeFrame(const uint8_t* pFrame, uint16_t w, uint16_t h) override;
+
+ private:
+	color16_graphics& _display; /**< Display the frames are drawn on */
+	int16_t _x; /**< X coordinate of the frame top left */
+	int16_t _y; /**< Y coordinate of the frame top left */
+};
 // ********************** EOF *********************
@@ -36,7 +36,12 @@ enum rvlDisplay_Return_Codes_e : uint8_t
 	rvlDisplay_SPIbeginFail = 16,          /**< bcm2835_spi_begin() has failed, running as root?*/
 	rvlDisplay_SPICEXPin = 17,             /**< SPICE_PIN value incorrect must be 0 or 1 */
 	rvlDisplay_ShapeScreenBounds = 19,     /**< Shape is outside screen bounds, check x and y */
-	rvlDisplay_MallocError = 20           /**< malloc could not assign memory*/
+	rvlDisplay_MallocError = 20,          /**< malloc could not assign memory*/
+	rvlDisplay_ClipStack = 21,            /**< Clip rectangle stack is full on push or empty on pop*/
+	rvlDisplay_FileOpen = 22,             /**< Image file could not be opened, check path*/
+	rvlDisplay_FileFormat = 23,           /**< Image file format is not supported or the header is invalid*/
+	rvlDisplay_FileRead = 24,             /**< Image file read failed or the file is truncated*/
+	rvlDisplay_TextScale = 25             /**< Text scale factor must be 1 to RVL_TEXT_SCALE_MAX*/
 };
 
 
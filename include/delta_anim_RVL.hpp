@@ -0,0 +1,139 @@
+/*!
+	@file     delta_anim_RVL.hpp
+	@author   Gavin Lyons
+	@brief    Delta frame animation container, frames hold only changed rectangles.
+				Project Name: ST7789_TFT_RPI
+	@details  Made by the rvl_anim tool (make tools) from a sequence of BMP files,
+				each frame is diffed against the one before and only the changed
+				rectangles stored, as raw big endian RGB565 or as an RLE565 image,
+				whichever is smaller. Frame 0 is the whole image. When there is more
+				than one frame a loop frame follows, the change from the last frame
+				back to frame 0, drawn in place of frame 0 on the second and later loops.
+				File layout, all header fields little endian:
+				-# rvlAnim_Header_t
+				-# for each frame: rvlAnim_FrameHeader_t, then for each rectangle
+				rvlAnim_RectHeader_t followed by its data, length bytes padded to 4
+				Drawn by drawAnimationFrame and playAnimation.
+*/
+
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+#include "common_data_RVL.hpp"
+
+#define RVL_ANIM_MAGIC "RVLA"        /**< First four bytes of an animation file */
+#define RVL_ANIM_VERSION 1           /**< Animation format version */
+#define RVL_ANIM_FLAG_LOOP 0x0001    /**< Header flag, a loop frame follows the last frame */
+#define RVL_ANIM_TILE 8              /**< Side in pixels of the tiles the encoder diffs in */
+#define RVL_ANIM_WINDOW_BYTES 11     /**< Bus bytes to set an address window, CASET RASET RAMWR and 8 data */
+
+/*! @brief Encoding of a rectangle's data */
+enum rvlAnim_Encoding_e : uint8_t
+{
+	RVL_ANIM_RAW565 = 0, /**< w*h big endian RGB565 pixels, rows top down */
+	RVL_ANIM_RLE565 = 1  /**< RLE565 image of w*h pixels, see rle565_RVL.hpp */
+};
+
+/*! @brief Animation file header */
+struct rvlAnim_Header_t
+{
+	char magic[4];      /**< RVL_ANIM_MAGIC */
+	uint16_t version;   /**< RVL_ANIM_VERSION */
+	uint16_t flags;     /**< RVL_ANIM_FLAG_LOOP */
+	uint16_t width;     /**< Width in pixels */
+	uint16_t height;    /**< Height in pixels */
+	uint16_t frames;    /**< Number of frames, not counting the loop frame */
+	uint16_t reserved;  /**< 0 */
+};
+
+/*! @brief Frame header, followed by rects rectangles */
+struct rvlAnim_FrameHeader_t
+{
+	uint16_t delayMs;   /**< Time the frame is shown, milliseconds */
+	uint16_t rects;     /**< Number of changed rectangles */
+};
+
+/*! @brief Rectangle header, followed by length bytes of data */
+struct rvlAnim_RectHeader_t
+{
+	uint16_t x;         /**< X offset in the animation */
+	uint16_t y;         /**< Y offset in the animation */
+	uint16_t w;         /**< Width in pixels */
+	uint16_t h;         /**< Height in pixels */
+	uint8_t encoding;   /**< rvlAnim_Encoding_e */
+	uint8_t reserved[3]; /**< 0 */
+	uint32_t length;    /**< Bytes of data, not counting padding */
+};
+
+static_assert(sizeof(rvlAnim_Header_t) == 16, "animation header layout");
+static_assert(sizeof(rvlAnim_FrameHeader_t) == 4, "animation frame header layout");
+static_assert(sizeof(rvlAnim_RectHeader_t) == 16, "animation rect header layout");
+
+/*! @brief One changed rectangle of an open animation, data points into the file */
+struct rvlAnimRect_t
+{
+	uint16_t x;           /**< X offset in the animation */
+	uint16_t y;           /**< Y offset in the animation */
+	uint16_t w;           /**< Width in pixels */
+	uint16_t h;           /**< Height in pixels */
+	rvlAnim_Encoding_e encoding; /**< Format of data */
+	const uint8_t* data;  /**< Rectangle data */
+	uint32_t length;      /**< Bytes of data */
+};
+
+/*! @brief One frame of an open animation */
+struct rvlAnimFrame_t
+{
+	uint16_t delayMs;     /**< Time the frame is shown, milliseconds */
+	uint16_t rectCount;   /**< Number of rectangles */
+	uint32_t firstRect;   /**< Index of the first rectangle, see deltaAnimation::rect */
+	uint32_t busBytes;    /**< Bytes sent to the display to draw the frame, pixels and address windows */
+};
+
+void DeltaAnimEncode(const uint8_t* const* pFrames, uint16_t count, uint16_t w, uint16_t h,
+	const uint16_t* pDelays, std::vector<uint8_t>& out);
+
+/*!
+	@brief Class to open an animation file or memory image and index its frames
+*/
+class deltaAnimation {
+
+ public:
+
+	deltaAnimation(){};
+	~deltaAnimation();
+	deltaAnimation(const deltaAnimation&) = delete;
+	deltaAnimation& operator=(const deltaAnimation&) = delete;
+
+	rvlDisplay_Return_Codes_e open(const char* path);
+	rvlDisplay_Return_Codes_e open(const uint8_t* pData, size_t len);
+	void close(void);
+
+	bool isOpen(void) const { return _pData != nullptr; } /**< @return true if an animation is open */
+	uint16_t width(void) const { return _width; }   /**< @return width in pixels */
+	uint16_t height(void) const { return _height; } /**< @return height in pixels */
+	uint16_t frameCount(void) const { return _frameCount; } /**< @return number of frames, not counting the loop frame */
+	bool hasLoopFrame(void) const { return _hasLoop; } /**< @return true if a loop frame follows the last frame */
+	const rvlAnimFrame_t* frame(uint16_t index) const;
+	const rvlAnimRect_t* rect(uint32_t index) const;
+	uint32_t loopBusBytes(void) const;
+
+ private:
+
+	rvlDisplay_Return_Codes_e readIndex(void);
+
+	const uint8_t* _pData = nullptr; /**< Whole animation, mapped file or caller's memory */
+	size_t _size = 0;                /**< Bytes at _pData */
+	bool _mapped = false;            /**< _pData is a file mapping to unmap on close */
+	uint16_t _width = 0;             /**< Width in pixels */
+	uint16_t _height = 0;            /**< Height in pixels */
+	uint16_t _frameCount = 0;        /**< Number of frames, not counting the loop frame */
+	bool _hasLoop = false;           /**< Loop frame follows the last frame */
+	rvlAnimFrame_t* _frames = nullptr; /**< Frame index built at open, loop frame last */
+	rvlAnimRect_t* _rects = nullptr;   /**< Rectangle index built at open */
+	uint32_t _rectCount = 0;         /**< Number of rectangles in all frames */
+};
+
+// ********************** EOF *********************
@@ -18,6 +18,14 @@
 		-#  pFontGroTesk 16 by 32
 		-#  pFontMint 24 by 32
 		-#  pFontSixteenSeg 32 by 48 (NUMBERS ONLY + : . -)
+		-#  pFontDefaultProp proportional, 8 high
+		-#  pFontArialBoldProp proportional, 16 high
+		Fixed fonts start with a 4 byte header, width, height, ASCII offset and
+		character count, then the glyphs, all one size. Proportional fonts are a
+		rvlPropFont_t, each glyph has its own bounding box and advance, found in
+		the glyph table by character with no search.
+		The geometry of the fixed fonts is also in rvlFontInfo, known at compile
+		time, setFont selects a glyph renderer built for the font's size.
 */
 
 #pragma once
@@ -43,6 +51,31 @@ extern const uint8_t * pFontGroTesk;
 extern const uint8_t * pFontMint;
 extern const uint8_t * pFontSixteenSeg;
 
+/*! @brief One glyph of a proportional font */
+struct rvlPropGlyph_t
+{
+	uint16_t offset;  /**< Byte offset of the glyph's bitmap in the font bitmap */
+	uint8_t width;    /**< Bounding box width in pixels, 0 for a blank glyph */
+	uint8_t height;   /**< Bounding box height in pixels */
+	uint8_t advance;  /**< Pixels from this character to the next, the cell width */
+	int8_t xOffset;   /**< Bounding box left edge from the cell left edge */
+	int8_t yOffset;   /**< Bounding box top edge from the cell top edge */
+};
+
+/*! @brief A proportional font, glyph table indexed by character - first */
+struct rvlPropFont_t
+{
+	const uint8_t* bitmap;        /**< Glyph bitmaps, each rows top down, width * height bits, most significant bit first, starting on a byte */
+	const rvlPropGlyph_t* glyphs; /**< One entry per character, first to last */
+	uint8_t first;                /**< First character */
+	uint8_t last;                 /**< Last character */
+	uint8_t height;               /**< Cell height in pixels, the line spacing */
+	uint8_t maxAdvance;           /**< Largest advance, used for wrapping */
+};
+
+extern const rvlPropFont_t * pFontDefaultProp;
+extern const rvlPropFont_t * pFontArialBoldProp;
+
 
 /*! Enum to define current font type selected  */
 enum display_Font_name_e : uint8_t
@@ -61,9 +94,61 @@ enum display_Font_name_e : uint8_t
 	font_arialRound = 12, /**< ArialRound 16by24 */
 	font_groTesk = 13,    /**< GroTesk 16by32 */
 	font_mint = 14,       /**< Mint 24by32 */
-	font_sixteenSeg = 15  /**< Sixteen Segment 32by48 (NUMBERS ONLY + : . -) */
+	font_sixteenSeg = 15, /**< Sixteen Segment 32by48 (NUMBERS ONLY + : . -) */
+	font_defaultProp = 16, /**< Proportional default, 8 high */
+	font_arialBoldProp = 17 /**< Proportional Arial bold, 16 high */
+};
+
+/*! @brief Bit layout of the glyphs of a fixed font */
+enum rvlFontLayout_e : uint8_t
+{
+	rvlFontLayout_Banded = 0,  /**< Height divisible by 8, 8 pixel tall bands of one byte per column, least significant bit at the top */
+	rvlFontLayout_Columns = 1  /**< One bit stream, column by column, most significant bit first */
 };
 
+/*! @brief Geometry of a fixed font, as in its 4 byte header */
+struct rvlFontInfo_t
+{
+	uint8_t width;    /**< Character width in pixels */
+	uint8_t height;   /**< Character height in pixels */
+	uint8_t offset;   /**< ASCII offset, first character */
+	uint8_t numChars; /**< Number of characters */
+
+	/*! @brief glyph bit layout, set by the height */
+	constexpr rvlFontLayout_e layout() const
+	{ return (height % 8 == 0) ? rvlFontLayout_Banded : rvlFontLayout_Columns; }
+	/*! @brief bytes of glyph data per character */
+	constexpr uint16_t glyphBytes() const
+	{ return (layout() == rvlFontLayout_Banded) ? width * (height / 8) : (width * height) / 8; }
+};
+
+/*! @brief Geometry of the fixed fonts, indexed by display_Font_name_e - 1 */
+constexpr rvlFontInfo_t rvlFontInfo[] =
+{
+	{6, 8, 0x00, 255},  // font_default
+	{4, 6, 0x20, 95},   // font_pico
+	{5, 8, 0x2D, 13},   // font_sevenSeg
+	{8, 8, 0x20, 58},   // font_thick
+	{9, 8, 0x20, 58},   // font_wide
+	{8, 8, 0x20, 95},   // font_sinclairS
+	{8, 16, 0x20, 95},  // font_retro
+	{16, 16, 0x20, 95}, // font_mega
+	{16, 16, 0x20, 95}, // font_arialBold
+	{16, 16, 0x20, 95}, // font_hallfetica
+	{16, 24, 0x20, 95}, // font_orla
+	{16, 24, 0x20, 95}, // font_arialRound
+	{16, 32, 0x20, 90}, // font_groTesk
+	{24, 32, 0x20, 90}, // font_mint
+	{32, 48, 0x2D, 13}  // font_sixteenSeg
+};
+
+/*! @brief Expands one glyph of a fixed font to big endian RGB565 pixels.
+	Arguments: glyph data, destination, bytes per destination row,
+	foreground color, background color, font width and height. */
+typedef void (*rvlGlyphRenderer_t)(const uint8_t*, uint8_t*, uint32_t, uint16_t, uint16_t, uint8_t, uint8_t);
+
+#define RVL_TEXT_SCALE_MAX 4 /**< Largest text scale factor, see setTextScale */
+
 /*! @brief Font class to hold font data object  */
 class display_Fonts
 {
@@ -72,8 +157,15 @@ class display_Fonts
 		~display_Fonts(){};
 		
 		rvlDisplay_Return_Codes_e setFont(display_Font_name_e);
+		rvlDisplay_Return_Codes_e setFont(const rvlPropFont_t* font);
+		display_Font_name_e getFont(void);
+		const rvlPropFont_t* getPropFont(void);
 		void setInvertFont(bool invertStatus);
 		bool getInvertFont(void);
+		bool getFontProportional(void);
+		uint16_t getTextWidth(const char* pText);
+		rvlDisplay_Return_Codes_e setTextScale(uint8_t scale);
+		uint8_t getTextScale(void);
 
 	protected:
 		const uint8_t *_FontSelect = pFontDefault; /**< Pointer to the active font,  Fonts Stored are Const */
@@ -81,6 +173,25 @@ class display_Fonts
 		uint8_t _Font_Y_Size = 0x08; /**< Height Size of a Font character */
 		uint8_t _FontOffset = 0x00; /**< Offset in the ASCII table 0x00 to 0xFF, where font begins */
 		uint8_t _FontNumChars = 0xFE; /**< Number of characters in font 0x00 to 0xFE */
+		const rvlPropFont_t* _FontProp = nullptr; /**< Active proportional font, nullptr for a fixed font */
+		rvlGlyphRenderer_t _FontRenderer = nullptr; /**< Glyph renderer for the fixed font's size and layout */
+		uint16_t _FontGlyphBytes = 6; /**< Bytes of glyph data per character of the fixed font */
+		display_Font_name_e _FontName = font_default; /**< Last fixed font selected by name */
+
+		/*! @brief Cell width of a character, the font width for fixed fonts
+			@param value character in the font's range
+			@return pixels from this character to the next */
+		uint8_t glyphAdvance(char value) const
+		{ return (_FontProp == nullptr) ? _Font_X_Size : _FontProp->glyphs[(uint8_t)value - _FontOffset].advance; }
+		/*! @brief Cell width of a character on screen, glyphAdvance times the text scale
+			@param value character in the font's range
+			@return pixels from this character to the next */
+		uint16_t textAdvance(char value) const { return glyphAdvance(value) * _textScale; }
+		/*! @brief Font width on screen, times the text scale */
+		uint16_t textCellWidth(void) const { return _Font_X_Size * _textScale; }
+		/*! @brief Font height on screen, times the text scale, the line spacing */
+		uint16_t textCellHeight(void) const { return _Font_Y_Size * _textScale; }
+		uint8_t _textScale = 1; /**< Text scale factor, each glyph pixel drawn as scale by scale pixels */
 	private:
 		bool _FontInverted = false; /**< Is the font inverted , False = normal , true = inverted*/
 };
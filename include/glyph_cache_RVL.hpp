@@ -0,0 +1,101 @@
+/*!
+	@file     glyph_cache_RVL.hpp
+	@author   Gavin Lyons
+	@brief    LRU cache of rendered font glyphs in display format, with a byte budget.
+				Project Name: ST7789_TFT_RPI
+	@details  Attach to the graphics class with setGlyphCache. writeChar, writeCharString
+				and print then render each glyph once, later draws of the same glyph
+				send the cached big endian RGB565 block with no bit unpacking.
+				Glyphs are keyed by font data, character, text colors and inversion,
+				so setFont, setTextColor and setInvertFont never see a stale glyph.
+				Glyphs of styles no longer drawn age out, least recently used first,
+				to keep the total under the budget.
+*/
+
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+#include <list>
+#include <unordered_map>
+#include <functional>
+
+/*! @brief Identifies a rendered glyph */
+struct rvlGlyphCache_Key_t
+{
+	const void* font = nullptr;    /**< Font data, fixed font bytes or rvlPropFont_t, as selected by setFont */
+	uint8_t character = 0;         /**< Character code */
+	bool inverted = false;         /**< Font inversion, colors swapped */
+	uint16_t color = 0;            /**< Text foreground color */
+	uint16_t bgcolor = 0;          /**< Text background color */
+
+	/*! @brief keys are equal if all fields are equal */
+	bool operator==(const rvlGlyphCache_Key_t& other) const
+	{
+		return font == other.font && character == other.character && inverted == other.inverted &&
+			color == other.color && bgcolor == other.bgcolor;
+	}
+};
+
+/*! @brief Hash of rvlGlyphCache_Key_t for the cache index */
+struct rvlGlyphCache_KeyHash_t
+{
+	/*! @brief combine the key fields into one hash */
+	size_t operator()(const rvlGlyphCache_Key_t& key) const
+	{
+		size_t h = std::hash<const void*>()(key.font);
+		h ^= ((uint64_t)key.color << 24 | (uint64_t)key.bgcolor << 8 | key.character) * 0x9E3779B97F4A7C15ULL;
+		return h ^ key.inverted;
+	}
+};
+
+/*! @brief Cache counters, see glyphCache::getStats */
+struct rvlGlyphCache_Stats_t
+{
+	uint32_t hits = 0;         /**< Glyphs served from the cache */
+	uint32_t misses = 0;       /**< Glyphs that had to be rendered */
+	uint32_t evictions = 0;    /**< Glyphs dropped to stay in budget */
+	uint32_t entries = 0;      /**< Glyphs held now */
+	size_t bytesUsed = 0;      /**< Bytes of glyph data held now */
+	size_t budgetBytes = 0;    /**< Maximum bytes of glyph data */
+};
+
+/*!
+	@brief Class to hold rendered glyphs, least recently used evicted first
+*/
+class glyphCache {
+
+ public:
+
+	explicit glyphCache(size_t budgetBytes);
+	glyphCache(const glyphCache&) = delete;
+	glyphCache& operator=(const glyphCache&) = delete;
+
+	const uint8_t* find(const rvlGlyphCache_Key_t& key);
+	uint8_t* insert(const rvlGlyphCache_Key_t& key, size_t bytes);
+	void invalidate(const void* font);
+	void clear(void);
+
+	void setBudget(size_t budgetBytes);
+	rvlGlyphCache_Stats_t getStats(void) const;
+	void resetStats(void);
+
+ private:
+
+	/*! @brief One rendered glyph and its key */
+	struct Entry
+	{
+		rvlGlyphCache_Key_t key;   /**< Glyph identity */
+		std::vector<uint8_t> data; /**< Big endian RGB565 pixels, rows top down */
+	};
+
+	void evictTo(size_t budgetBytes);
+	void eraseEntry(std::list<Entry>::iterator it);
+
+	std::list<Entry> _lru; /**< Most recently used at front */
+	std::unordered_map<rvlGlyphCache_Key_t, std::list<Entry>::iterator, rvlGlyphCache_KeyHash_t> _index; /**< Key to list position */
+	rvlGlyphCache_Stats_t _stats; /**< Counters and budget */
+};
+
+// ********************** EOF *********************
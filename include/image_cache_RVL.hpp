@@ -0,0 +1,117 @@
+/*!
+	@file     image_cache_RVL.hpp
+	@author   Gavin Lyons
+	@brief    LRU cache of images converted to display format, with a byte budget.
+				Project Name: ST7789_TFT_RPI
+	@details  Attach to the graphics class with setImageCache. drawBitmap24,
+				drawBitmap16 and drawBitmapFile(path) then convert an image once,
+				later draws of the same source send the cached big endian RGB565
+				data with no conversion. Least recently used images are evicted
+				to keep the total under the budget.
+*/
+
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <string>
+#include <vector>
+#include <list>
+#include <unordered_map>
+#include <functional>
+
+/*! @brief Identifies the source of a cached image */
+struct rvlImageCache_Key_t
+{
+	const void* source = nullptr; /**< Source data pointer, nullptr for files */
+	std::string path;             /**< Source file path, empty for pointers */
+	uint16_t width = 0;           /**< Source width in pixels, 0 for files */
+	uint16_t height = 0;          /**< Source height in pixels, 0 for files */
+	uint8_t format = 0;           /**< Source bits per pixel, 0 for files */
+	int64_t mtimeSec = 0;         /**< File modification time, seconds, 0 for pointers */
+	int64_t mtimeNsec = 0;        /**< File modification time, nanoseconds part, 0 for pointers */
+	int64_t size = 0;             /**< File size in bytes, 0 for pointers */
+
+	/*! @brief keys are equal if all fields are equal */
+	bool operator==(const rvlImageCache_Key_t& other) const
+	{
+		return source == other.source && width == other.width && height == other.height &&
+			format == other.format && mtimeSec == other.mtimeSec && mtimeNsec == other.mtimeNsec &&
+			size == other.size && path == other.path;
+	}
+};
+
+/*! @brief Hash of rvlImageCache_Key_t for the cache index */
+struct rvlImageCache_KeyHash_t
+{
+	/*! @brief combine the key fields into one hash */
+	size_t operator()(const rvlImageCache_Key_t& key) const
+	{
+		size_t h = std::hash<const void*>()(key.source) ^ (std::hash<std::string>()(key.path) << 1);
+		h ^= ((size_t)key.width << 16 | key.height) * 0x9E3779B1u;
+		h ^= std::hash<uint8_t>()(key.format) + 0x9E3779B9u + (h << 6) + (h >> 2);
+		h ^= std::hash<int64_t>()(key.mtimeSec) + 0x9E3779B9u + (h << 6) + (h >> 2);
+		h ^= std::hash<int64_t>()(key.mtimeNsec) + 0x9E3779B9u + (h << 6) + (h >> 2);
+		h ^= std::hash<int64_t>()(key.size) + 0x9E3779B9u + (h << 6) + (h >> 2);
+		return h;
+	}
+};
+
+/*! @brief A cached image in display format */
+struct rvlCachedImage_t
+{
+	uint16_t width = 0;         /**< Width in pixels */
+	uint16_t height = 0;        /**< Height in pixels */
+	std::vector<uint8_t> data;  /**< Big endian RGB565 pixels, rows top down */
+};
+
+/*! @brief Cache counters, see imageCache::getStats */
+struct rvlImageCache_Stats_t
+{
+	uint32_t hits = 0;         /**< Draws served from the cache */
+	uint32_t misses = 0;       /**< Draws that had to convert */
+	uint32_t evictions = 0;    /**< Images dropped to stay in budget */
+	uint32_t entries = 0;      /**< Images held now */
+	size_t bytesUsed = 0;      /**< Bytes of image data held now */
+	size_t budgetBytes = 0;    /**< Maximum bytes of image data */
+};
+
+/*!
+	@brief Class to hold converted images, least recently used evicted first
+*/
+class imageCache {
+
+ public:
+
+	explicit imageCache(size_t budgetBytes);
+	imageCache(const imageCache&) = delete;
+	imageCache& operator=(const imageCache&) = delete;
+
+	const rvlCachedImage_t* find(const rvlImageCache_Key_t& key);
+	uint8_t* insert(const rvlImageCache_Key_t& key, uint16_t width, uint16_t height);
+	void erase(const rvlImageCache_Key_t& key);
+	void invalidate(const void* source);
+	void clear(void);
+
+	void setBudget(size_t budgetBytes);
+	rvlImageCache_Stats_t getStats(void) const;
+	void resetStats(void);
+
+ private:
+
+	/*! @brief One cached image and its key */
+	struct Entry
+	{
+		rvlImageCache_Key_t key;   /**< Source of the image */
+		rvlCachedImage_t image;    /**< Converted image */
+	};
+
+	void evictTo(size_t budgetBytes);
+	void eraseEntry(std::list<Entry>::iterator it);
+
+	std::list<Entry> _lru; /**< Most recently used at front */
+	std::unordered_map<rvlImageCache_Key_t, std::list<Entry>::iterator, rvlImageCache_KeyHash_t> _index; /**< Key to list position */
+	rvlImageCache_Stats_t _stats; /**< Counters and budget */
+};
+
+// ********************** EOF *********************
@@ -0,0 +1,143 @@
+/*!
+	@file     jpeg_RVL.hpp
+	@author   Gavin Lyons
+	@brief    Baseline JPEG decoder, streams one MCU row at a time as RGB565.
+				Project Name: ST7789_TFT_RPI
+	@details  Integer only. Baseline and extended sequential Huffman JPEG,
+				8 bit samples, grayscale or YCbCr with sampling factors of 1 or 2
+				(4:4:4, 4:2:2, 4:4:0, 4:2:0), restart markers. Progressive,
+				arithmetic coded, lossless and CMYK files are rejected, as are
+				16 bit quantisation tables with a step above 255.
+				Each MCU row is colour converted straight to big endian RGB565, so
+				memory is one strip of output rows plus the decoder tables.
+				Scaling by 1/2, 1/4 and 1/8 is done inside the inverse DCT, with
+				4x4, 2x2 and DC only transforms, which makes the smaller sizes
+				cheaper to decode than the full size.
+*/
+
+#pragma once
+
+#include <cstdio>
+#include <cstdint>
+#include <cstddef>
+#include "common_data_RVL.hpp"
+
+#define RVL_JPEG_READ_BUFFER_SIZE 4096 /**< Size in bytes of the decoder file read buffer */
+#define RVL_JPEG_HUFF_LOOKUP_BITS 9    /**< Huffman codes this long or shorter are decoded by one table lookup */
+
+/*!
+	@brief Class to decode a baseline JPEG image from memory or a file, an MCU row at a time
+*/
+class jpegDecoder {
+
+ public:
+
+	/*! Scale factors applied while decoding */
+	enum JPEGScale_e : uint8_t
+	{
+		JPEG_Scale_1 = 0, /**< Full size */
+		JPEG_Scale_2 = 1, /**< 1/2 size, 4x4 inverse DCT */
+		JPEG_Scale_4 = 2, /**< 1/4 size, 2x2 inverse DCT */
+		JPEG_Scale_8 = 3  /**< 1/8 size, DC coefficient only */
+	};
+
+	jpegDecoder(){};
+	~jpegDecoder();
+	jpegDecoder(const jpegDecoder&) = delete;
+	jpegDecoder& operator=(const jpegDecoder&) = delete;
+
+	rvlDisplay_Return_Codes_e open(const char* path);
+	rvlDisplay_Return_Codes_e open(const uint8_t* pData, size_t len);
+	void close(void);
+	rvlDisplay_Return_Codes_e rewind(void);
+	void setScale(JPEGScale_e scale);
+	rvlDisplay_Return_Codes_e readMCURow(uint16_t x, uint16_t w, uint8_t* pDst);
+
+	uint16_t width(void) const { return _width; }   /**< @return image width in pixels */
+	uint16_t height(void) const { return _height; } /**< @return image height in pixels */
+	uint8_t components(void) const { return _numComponents; } /**< @return 1 grayscale or 3 YCbCr */
+	JPEGScale_e scale(void) const { return _scale; } /**< @return scale set by setScale */
+	uint16_t scaledWidth(void) const { return (_width + (1 << _scale) - 1) >> _scale; }   /**< @return output width in pixels at the current scale */
+	uint16_t scaledHeight(void) const { return (_height + (1 << _scale) - 1) >> _scale; } /**< @return output height in pixels at the current scale */
+	uint16_t stripHeight(void) const { return (_maxV * 8) >> _scale; } /**< @return output rows in a full MCU row at the current scale */
+	uint16_t row(void) const { return _row; } /**< @return next output row readMCURow returns */
+	uint16_t stripRows(void) const;
+
+ private:
+
+	/*! @brief Huffman table, fast lookup for short codes then canonical code ranges */
+	struct HuffTable
+	{
+		uint16_t lookup[1 << RVL_JPEG_HUFF_LOOKUP_BITS]; /**< (length << 8) | value, 0 if code is longer */
+		int32_t maxCode[18];   /**< Largest code of each length, -1 if none */
+		int32_t valOffset[17]; /**< Index into values of a code of each length, minus that code */
+		uint8_t values[256];   /**< Symbols in code order */
+		bool defined;          /**< Table has been loaded by a DHT segment */
+	};
+
+	/*! @brief One image component, sampling, tables and state */
+	struct Component
+	{
+		uint8_t id;       /**< Component identifier from SOF */
+		uint8_t h;        /**< Horizontal sampling factor, 1 or 2 */
+		uint8_t v;        /**< Vertical sampling factor, 1 or 2 */
+		uint8_t tq;       /**< Quantisation table number */
+		uint8_t td;       /**< DC Huffman table number */
+		uint8_t ta;       /**< AC Huffman table number */
+		int32_t dcPred;   /**< DC predictor */
+		uint8_t scale;    /**< Decode scale of this component, JPEGScale_e */
+		uint8_t stride;   /**< Bytes per row of samples */
+		uint8_t hShift;   /**< Output pixels per sample across, as a shift */
+		uint8_t vShift;   /**< Output pixels per sample down, as a shift */
+		uint8_t samples[16 * 16]; /**< Decoded samples of this component for one MCU */
+	};
+
+	rvlDisplay_Return_Codes_e readHeader(void);
+	rvlDisplay_Return_Codes_e readDQT(uint16_t len);
+	rvlDisplay_Return_Codes_e readDHT(uint16_t len);
+	rvlDisplay_Return_Codes_e readSOF(uint16_t len);
+	rvlDisplay_Return_Codes_e readSOS(uint16_t len);
+	void setupComponents(void);
+	bool decodeMCU(bool output);
+	bool decodeBlock(Component& comp, uint8_t* pOut, uint8_t stride, bool output);
+	void processRestart(void);
+	void outputMCU(uint16_t mcuX, uint16_t rows, uint16_t x, uint16_t w, uint8_t* pDst);
+
+	bool getByte(uint8_t& b);
+	bool getWord(uint16_t& w);
+	bool skipBytes(uint32_t n);
+	uint8_t nextScanByte(void);
+	void fillBits(void);
+	uint32_t getBits(uint8_t n);
+	int32_t receiveExtend(uint8_t n);
+	int16_t decodeHuffman(const HuffTable& table);
+
+	FILE* _pFile = nullptr;         /**< Open file, nullptr for memory */
+	const uint8_t* _pBuf = nullptr; /**< Memory image, or _readBuffer for files */
+	size_t _pos = 0;                /**< Next byte in _pBuf */
+	size_t _end = 0;                /**< Bytes valid in _pBuf */
+	bool _dataEnd = false;          /**< Read past the end of the data */
+
+	uint32_t _bitBuf = 0;           /**< Entropy coded bits, right aligned */
+	uint8_t _bitCount = 0;          /**< Valid bits in _bitBuf */
+	uint8_t _marker = 0;            /**< Marker found in the entropy coded data, 0 if none */
+
+	uint16_t _width = 0;            /**< Image width in pixels */
+	uint16_t _height = 0;           /**< Image height in pixels */
+	uint8_t _numComponents = 0;     /**< 1 or 3 */
+	uint8_t _maxH = 1;              /**< Largest horizontal sampling factor */
+	uint8_t _maxV = 1;              /**< Largest vertical sampling factor */
+	uint16_t _mcusX = 0;            /**< MCUs in each MCU row */
+	uint16_t _restartInterval = 0;  /**< MCUs between restart markers, 0 for none */
+	uint16_t _restartsLeft = 0;     /**< MCUs before the next restart marker */
+	uint16_t _row = 0;              /**< Next output row at the current scale */
+	JPEGScale_e _scale = JPEG_Scale_1; /**< Output scale */
+
+	Component _comp[3];             /**< Image components */
+	uint16_t _quant[4][64];         /**< Quantisation tables, zig-zag order */
+	HuffTable _huffDC[2];           /**< DC Huffman tables */
+	HuffTable _huffAC[2];           /**< AC Huffman tables */
+	uint8_t _readBuffer[RVL_JPEG_READ_BUFFER_SIZE]; /**< File data on its way to the decoder */
+};
+
+// ********************** EOF *********************
@@ -0,0 +1,35 @@
+/*!
+	@file     pixel_convert_RVL.hpp
+	@author   Gavin Lyons
+	@brief    Row conversion kernels from common bitmap pixel formats to
+				panel native big endian RGB565. Project Name: ST7789_TFT_RPI
+	@details  NEON is used on Raspberry Pi, SSSE3 on x86 hosts, otherwise a
+				portable scalar loop. All kernels read and write exactly
+				pixels worth of data, never past the ends of the buffers.
+*/
+
+#pragma once
+
+#include <cstdint>
+
+void ConvertBGR888toRGB565BE(const uint8_t* pSrc, uint8_t* pDst, uint32_t pixels);
+void ConvertRGB565LEtoBE(const uint8_t* pSrc, uint8_t* pDst, uint32_t pixels);
+void ConvertBGRA8888toRGB565BE(const uint8_t* pSrc, uint8_t* pDst, uint32_t pixels);
+void ConvertRGB555LEtoRGB565BE(const uint8_t* pSrc, uint8_t* pDst, uint32_t pixels);
+
+/*!
+	@brief Lookup table from one byte of a 1 bit bitmap, most significant bit
+		first, to its 8 pixels in big endian RGB565, for one color pair
+*/
+struct rvlMono1LUT_t
+{
+	uint16_t color = 0;      /**< Color of set bits */
+	uint16_t bgcolor = 0;    /**< Color of clear bits */
+	bool valid = false;      /**< Table has been built for color and bgcolor */
+	uint8_t pixels[256][16]; /**< 8 pixels, 16 bytes in display order, for each source byte */
+};
+
+void BuildMono1LUT(rvlMono1LUT_t& lut, uint16_t color, uint16_t bgcolor);
+void ConvertMono1toRGB565BE(const uint8_t* pSrc, uint8_t firstBit, uint8_t* pDst, uint32_t pixels, const rvlMono1LUT_t& lut);
+
+// ********************** EOF *********************
@@ -65,7 +65,7 @@ protected:
 	void setWriteError(int err = 1) { write_error = err; }
 private:
 	int write_error; /*! class Error flag */
-	size_t printNumber(unsigned long, uint8_t);
+	size_t printNumber(unsigned long, uint8_t, bool = false);
 	size_t printFloat(double, uint8_t);
 
 };
@@ -0,0 +1,77 @@
+/*!
+	@file     qoi_RVL.hpp
+	@author   Gavin Lyons
+	@brief    QOI (Quite OK Image) lossless image format, encoder and streaming decoder.
+				Project Name: ST7789_TFT_RPI
+	@details  See qoiformat.org for the format. The decoder works a row at a
+				time, converting each pixel straight to big endian RGB565, so
+				no full frame is ever held. Alpha is ignored. Files can be made
+				from BMP files by the rvl_qoi tool (make tools).
+*/
+
+#pragma once
+
+#include <cstdio>
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+#include "common_data_RVL.hpp"
+
+#define RVL_QOI_HEADER_SIZE 14           /**< Bytes of QOI header */
+#define RVL_QOI_READ_BUFFER_SIZE 4096    /**< Size in bytes of the decoder file read buffer */
+
+void QOIEncode(const uint8_t* pPixels, uint16_t w, uint16_t h, uint8_t channels, std::vector<uint8_t>& out);
+
+/*!
+	@brief Class to decode a QOI image from memory or a file, a row at a time
+*/
+class qoiDecoder {
+
+ public:
+
+	qoiDecoder(){};
+	~qoiDecoder();
+	qoiDecoder(const qoiDecoder&) = delete;
+	qoiDecoder& operator=(const qoiDecoder&) = delete;
+
+	rvlDisplay_Return_Codes_e open(const char* path);
+	rvlDisplay_Return_Codes_e open(const uint8_t* pData, size_t len);
+	void close(void);
+	rvlDisplay_Return_Codes_e rewind(void);
+	rvlDisplay_Return_Codes_e readRows(uint16_t rows, uint16_t x, uint16_t w, uint8_t* pDst);
+	rvlDisplay_Return_Codes_e skipRows(uint16_t rows);
+
+	uint16_t width(void) const { return _width; }     /**< @return image width in pixels */
+	uint16_t height(void) const { return _height; }   /**< @return image height in pixels */
+	uint8_t channels(void) const { return _channels; } /**< @return 3 RGB or 4 RGBA */
+	uint16_t row(void) const { return _row; }          /**< @return next row readRows will return */
+
+ private:
+
+	/*! @brief One pixel of decoder state */
+	struct Pixel
+	{
+		uint8_t r, g, b, a; /**< Red, green, blue, alpha */
+	};
+
+	rvlDisplay_Return_Codes_e readHeader(void);
+	bool decodeRow(uint8_t* pDst, uint16_t x, uint16_t w);
+	bool fill(size_t bytes);
+	bool chunkAvailable(void) const;
+
+	FILE* _pFile = nullptr;         /**< Open file, nullptr for memory */
+	const uint8_t* _pBuf = nullptr; /**< Memory image, or _readBuffer for files */
+	size_t _pos = 0;                /**< Next byte in _pBuf */
+	size_t _end = 0;                /**< Bytes valid in _pBuf */
+	bool _eof = false;              /**< File fully read into the buffer */
+	uint16_t _width = 0;            /**< Image width in pixels */
+	uint16_t _height = 0;           /**< Image height in pixels */
+	uint8_t _channels = 0;          /**< 3 or 4 */
+	uint16_t _row = 0;              /**< Next row to decode */
+	Pixel _px{0, 0, 0, 255};        /**< Previous pixel */
+	uint8_t _run = 0;               /**< Repeats of _px still to output */
+	Pixel _index[64];               /**< Recently seen pixels */
+	uint8_t _readBuffer[RVL_QOI_READ_BUFFER_SIZE]; /**< File data on its way to the decoder */
+};
+
+// ********************** EOF *********************
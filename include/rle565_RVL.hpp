@@ -0,0 +1,90 @@
+/*!
+	@file     rle565_RVL.hpp
+	@author   Gavin Lyons
+	@brief    Run length encoded RGB565 image format, encoder and streaming decoder.
+				Project Name: ST7789_TFT_RPI
+	@details  File layout, header fields little endian:
+				-# rvlRLE565_Header_t
+				-# packets until width*height pixels, raster order top down,
+				packets may run on from one row to the next.
+				Packet control byte: bit 7 set = run, clear = literal. Bits 0-6 = n,
+				count = n + 1, or if n is 127 a uint16 little endian e follows and
+				count = 128 + e. A run is followed by one pixel, a literal by count
+				pixels. Pixels are big endian RGB565, the display's own order.
+				Files are made by the rvl_rle tool (make tools) and drawn by
+				drawRLE565 / drawRLE565File.
+*/
+
+#pragma once
+
+#include <cstdio>
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+#include "common_data_RVL.hpp"
+
+#define RVL_RLE565_MAGIC "RVLR"          /**< First four bytes of a RLE565 image */
+#define RVL_RLE565_HEADER_SIZE 8         /**< Bytes of rvlRLE565_Header_t */
+#define RVL_RLE565_MAX_COUNT (128 + 0xFFFF) /**< Most pixels in one packet */
+#define RVL_RLE565_READ_BUFFER_SIZE 4096 /**< Size in bytes of the decoder file read buffer */
+#define RVL_RLE565_REPEAT_MIN 64        /**< Runs this long or longer are sent by repeat fill, shorter ones are expanded */
+
+/*! @brief RLE565 image header */
+struct rvlRLE565_Header_t
+{
+	char magic[4];     /**< RVL_RLE565_MAGIC */
+	uint16_t width;    /**< Width in pixels */
+	uint16_t height;   /**< Height in pixels */
+};
+
+/*! @brief One decoded piece of an RLE565 image */
+struct rvlRLE565_Segment_t
+{
+	bool run = false;                /**< true: count pixels of color, false: count pixels at pixels */
+	uint16_t color = 0;              /**< Run color, 565 */
+	const uint8_t* pixels = nullptr; /**< Literal pixels, big endian 565, valid until next call */
+	uint32_t count = 0;              /**< Number of pixels */
+};
+
+void RLE565Encode(const uint8_t* pPixels, uint16_t w, uint16_t h, std::vector<uint8_t>& out);
+
+/*!
+	@brief Class to decode an RLE565 image from memory or a file, a segment at a time
+*/
+class rle565Decoder {
+
+ public:
+
+	rle565Decoder(){};
+	~rle565Decoder();
+	rle565Decoder(const rle565Decoder&) = delete;
+	rle565Decoder& operator=(const rle565Decoder&) = delete;
+
+	rvlDisplay_Return_Codes_e open(const char* path);
+	rvlDisplay_Return_Codes_e open(const uint8_t* pData, size_t len);
+	void close(void);
+	rvlDisplay_Return_Codes_e rewind(void);
+	bool next(rvlRLE565_Segment_t& segment);
+
+	uint16_t width(void) const { return _width; }   /**< @return image width in pixels */
+	uint16_t height(void) const { return _height; } /**< @return image height in pixels */
+	rvlDisplay_Return_Codes_e status(void) const { return _status; } /**< @return error that stopped next, or rvlDisplay_Success */
+
+ private:
+
+	rvlDisplay_Return_Codes_e readHeader(void);
+	bool fill(size_t bytes);
+
+	FILE* _pFile = nullptr;         /**< Open file, nullptr for memory */
+	const uint8_t* _pBuf = nullptr; /**< Memory image, or _readBuffer for files */
+	size_t _pos = 0;                /**< Next byte in _pBuf */
+	size_t _end = 0;                /**< Bytes valid in _pBuf */
+	uint32_t _pixelsLeft = 0;       /**< Pixels not yet returned by packet headers */
+	uint32_t _literalLeft = 0;      /**< Pixels left in the current literal packet */
+	uint16_t _width = 0;            /**< Image width in pixels */
+	uint16_t _height = 0;           /**< Image height in pixels */
+	rvlDisplay_Return_Codes_e _status = rvlDisplay_Success; /**< Decode status */
+	uint8_t _readBuffer[RVL_RLE565_READ_BUFFER_SIZE]; /**< File data on its way to the display */
+};
+
+// ********************** EOF *********************
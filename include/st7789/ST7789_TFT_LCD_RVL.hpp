@@ -12,6 +12,7 @@
 #include <cstring>
 #include <bcm2835.h> // Dependency
 #include "color16_graphics_RVL.hpp"
+#include "text_grid_RVL.hpp"
 
 /*!
 	@brief Class to control ST7789 TFT basic functionality.
@@ -0,0 +1,112 @@
+/*!
+	@file     text_grid_RVL.hpp
+	@author   Gavin Lyons
+	@brief    Grid of character cells in a fixed width font, redraws only the cells that changed.
+				Project Name: ST7789_TFT_RPI
+	@details  The grid holds the character and colors of each cell, as staged by
+				setCell and print, and what was last drawn. update compares the two
+				and sends each run of changed neighbouring cells in a row, with the
+				same colors, as one strip, one address window. A screen of text with
+				one changed digit costs one glyph on the bus. numericField is a one
+				row grid showing a number, a count going up by one sends one glyph.
+*/
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+#include "color16_graphics_RVL.hpp"
+
+/*! @brief Contents of one grid cell */
+struct rvlTextCell_t
+{
+	char value = ' ';          /**< Character */
+	uint16_t color = 0xFFFF;   /**< Foreground color */
+	uint16_t bgcolor = 0x0000; /**< Background color */
+
+	/*! @brief cells are equal if character and colors are equal */
+	bool operator==(const rvlTextCell_t& other) const
+	{
+		return value == other.value && color == other.color && bgcolor == other.bgcolor;
+	}
+	/*! @brief cells differ if character or a color differs */
+	bool operator!=(const rvlTextCell_t& other) const { return !(*this == other); }
+};
+
+/*!
+	@brief Class for a grid of text cells on a display, drawn by change
+*/
+class textGrid {
+
+ public:
+
+	textGrid(color16_graphics& display, int16_t x, int16_t y, uint8_t cols, uint8_t rows,
+		display_Font_name_e font, uint8_t scale = 1);
+
+	void setColor(uint16_t color, uint16_t bgcolor);
+	rvlDisplay_Return_Codes_e setCell(uint8_t col, uint8_t row, char value);
+	rvlDisplay_Return_Codes_e print(uint8_t col, uint8_t row, const char* pText);
+	void clear(void);
+
+	rvlDisplay_Return_Codes_e update(void);
+	void invalidate(void);
+
+	uint16_t cellWidth(void) const;
+	uint16_t cellHeight(void) const;
+	uint32_t getCellsDrawn(void) const;
+	uint32_t getRunsDrawn(void) const;
+
+ private:
+
+	color16_graphics& _display; /**< Display the grid is drawn on */
+	int16_t _x; /**< X coordinate of the grid top left */
+	int16_t _y; /**< Y coordinate of the grid top left */
+	uint8_t _cols; /**< Cells across */
+	uint8_t _rows; /**< Cells down */
+	display_Font_name_e _font; /**< Fixed width font of the grid */
+	uint8_t _scale; /**< Text scale of the grid */
+	uint16_t _color = 0xFFFF; /**< Foreground color for setCell and print */
+	uint16_t _bgcolor = 0x0000; /**< Background color for setCell and print */
+
+	std::vector<rvlTextCell_t> _cells; /**< Staged contents, row by row */
+	std::vector<rvlTextCell_t> _drawn; /**< Contents last drawn, row by row */
+	bool _redrawAll = true; /**< Draw every cell on the next update, nothing drawn yet */
+	bool _spaceInFont = true; /**< Font has a space, if not spaces are filled with the background color */
+	uint32_t _cellsDrawn = 0; /**< Cells sent by the last update */
+	uint32_t _runsDrawn = 0; /**< Address windows sent by the last update */
+};
+
+/*! @brief Alignment of the number in a numericField */
+enum rvlFieldAlign_e : uint8_t
+{
+	rvlFieldAlign_Left = 0,  /**< First digit in the first cell, blanks after */
+	rvlFieldAlign_Right = 1  /**< Last digit in the last cell, blanks before */
+};
+
+/*!
+	@brief Class for a fixed width number on a display, sends only the changed digits
+*/
+class numericField {
+
+ public:
+
+	numericField(color16_graphics& display, int16_t x, int16_t y, uint8_t width,
+		display_Font_name_e font, rvlFieldAlign_e align = rvlFieldAlign_Right, uint8_t scale = 1);
+
+	void setColor(uint16_t color, uint16_t bgcolor);
+	rvlDisplay_Return_Codes_e setValue(int32_t value);
+	rvlDisplay_Return_Codes_e setValue(double value, uint8_t decimals);
+	rvlDisplay_Return_Codes_e setFixed(int32_t value, uint8_t decimals);
+	void invalidate(void);
+	uint32_t getCellsDrawn(void) const;
+
+ private:
+
+	rvlDisplay_Return_Codes_e show(const char* pText, size_t length);
+
+	textGrid _grid; /**< One row of cells holding the number */
+	uint8_t _width; /**< Field width in characters */
+	rvlFieldAlign_e _align; /**< Alignment of the number in the field */
+};
+
+// ********************** EOF *********************
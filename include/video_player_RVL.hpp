@@ -0,0 +1,103 @@
+/*!
+	@file     video_player_RVL.hpp
+	@author   Gavin Lyons
+	@brief    Player for raw big endian RGB565 video from a file descriptor.
+				Project Name: ST7789_TFT_RPI
+	@details  Frames are fixed size, width * height * 2 bytes, display order,
+				as written by e.g. ffmpeg -f rawvideo -pix_fmt rgb565be.
+				A reader thread fills one of two frame buffers while the other
+				is sent, frames are paced to a target rate and dropped when
+				they are more than one frame period late. Frames go to a
+				rvlFrameSink, the display (rvlDisplayFrameSink in
+				color16_graphics_RVL.hpp) or rvlRecordingSink to run the player
+				on a host without a panel.
+*/
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+#include <atomic>
+#include "common_data_RVL.hpp"
+
+/*!
+	@brief Destination of the frames of a videoPlayer
+*/
+class rvlFrameSink {
+ public:
+	virtual ~rvlFrameSink(){};
+	/*!
+		@brief Send one frame
+		@param pFrame big endian RGB565 pixels, rows top down
+		@param w frame width in pixels
+		@param h frame height in pixels
+		@return rvlDisplay_Success, or an error code which stops playback
+	*/
+	virtual rvlDisplay_Return_Codes_e writeFrame(const uint8_t* pFrame, uint16_t w, uint16_t h) = 0;
+};
+
+/*! @brief One frame seen by a rvlRecordingSink */
+struct rvlRecordedFrame_t
+{
+	uint32_t bytes;  /**< Frame size in bytes */
+	uint32_t hash;   /**< FNV-1a hash of the frame data */
+	uint64_t timeUs; /**< steady clock time the frame arrived, microseconds */
+};
+
+/*!
+	@brief Frame sink which records what it is sent, for running the player on a host
+*/
+class rvlRecordingSink : public rvlFrameSink {
+ public:
+	explicit rvlRecordingSink(uint32_t busTimeUs = 0);
+	rvlDisplay_Return_Codes_e writeFrame(const uint8_t* pFrame, uint16_t w, uint16_t h) override;
+	const std::vector<rvlRecordedFrame_t>& frames(void) const { return _frames; } /**< @return frames recorded so far */
+	void clear(void) { _frames.clear(); } /**< Forget the recorded frames */
+
+ private:
+	uint32_t _busTimeUs; /**< Time each frame takes, to act like a display bus */
+	std::vector<rvlRecordedFrame_t> _frames; /**< Frames in order received */
+};
+
+/*! @brief Playback statistics of a videoPlayer */
+struct rvlVideo_Stats_t
+{
+	uint32_t framesRead = 0;    /**< Complete frames read from the input */
+	uint32_t framesShown = 0;   /**< Frames sent to the sink */
+	uint32_t framesDropped = 0; /**< Frames skipped because they were late */
+	uint64_t elapsedUs = 0;     /**< Time from the first frame sent to the last, microseconds */
+	float fps = 0.0f;           /**< Frames shown per second achieved */
+	uint32_t latencyMinUs = 0;  /**< Shortest time from a frame being read to it being sent */
+	uint32_t latencyAvgUs = 0;  /**< Mean time from a frame being read to it being sent */
+	uint32_t latencyMaxUs = 0;  /**< Longest time from a frame being read to it being sent */
+};
+
+/*!
+	@brief Class to play fixed size raw RGB565 frames from a file, pipe or stdin
+*/
+class videoPlayer {
+
+ public:
+
+	videoPlayer(uint16_t w, uint16_t h);
+	videoPlayer(const videoPlayer&) = delete;
+	videoPlayer& operator=(const videoPlayer&) = delete;
+
+	rvlDisplay_Return_Codes_e play(int fd, rvlFrameSink& sink, float fps, uint32_t maxFrames = 0);
+	void stop(void);
+	const rvlVideo_Stats_t& getStats(void) const { return _stats; } /**< @return statistics of the last play */
+	uint32_t frameBytes(void) const { return _frameBytes; } /**< @return bytes in one frame */
+
+ private:
+
+	void readerLoop(int fd);
+	bool readFrame(int fd, uint8_t* pDst);
+
+	uint16_t _width;      /**< Frame width in pixels */
+	uint16_t _height;     /**< Frame height in pixels */
+	uint32_t _frameBytes; /**< Bytes in one frame */
+	rvlVideo_Stats_t _stats; /**< Statistics of the last play */
+	std::atomic<bool> _stop{false}; /**< Set by stop to end playback */
+};
+
+// ********************** EOF *********************
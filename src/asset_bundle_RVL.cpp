@@ -0,0 +1,144 @@
+/*!
+	@file     asset_bundle_RVL.cpp
+	@author   Gavin Lyons
+	@brief    Memory mapped bundle of images stored in panel native format.
+				Project Name: ST7789_TFT_RPI
+*/
+
+#include <iostream>
+#include <cstring>
+#include <new>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include "../include/asset_bundle_RVL.hpp"
+
+/*!
+	@brief Destructor, unmaps any open bundle
+*/
+assetBundle::~assetBundle()
+{
+	close();
+}
+
+/*!
+	@brief Map a bundle file and check its index
+	@param path file system path of the bundle
+	@return enum rvlDisplay_Return_Codes_e
+		-# rvlDisplay_Success for success
+		-# rvlDisplay_FileOpen file could not be opened or mapped
+		-# rvlDisplay_FileFormat bad magic, version or an entry outside the file
+		-# rvlDisplay_MallocError no memory for the index
+	@note Only the header and index are touched, image pages are read by the
+		kernel as they are first drawn.
+*/
+rvlDisplay_Return_Codes_e assetBundle::open(const char* path)
+{
+	close();
+	int fd = (path == nullptr) ? -1 : ::open(path, O_RDONLY);
+	struct stat st;
+	if (fd < 0 || fstat(fd, &st) != 0 || st.st_size < (off_t)sizeof(rvlBundle_Header_t))
+	{
+		std::cout << "Error assetBundle open 1: File could not be opened : " << (path ? path : "nullptr") << std::endl;
+		if (fd >= 0) ::close(fd);
+		return rvlDisplay_FileOpen;
+	}
+	void* pMap = mmap(nullptr, st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+	::close(fd); // mapping holds its own reference
+	if (pMap == MAP_FAILED)
+	{
+		std::cout << "Error assetBundle open 2: mmap failed" << std::endl;
+		return rvlDisplay_FileOpen;
+	}
+	_pMap = (const uint8_t*)pMap;
+	_mapSize = st.st_size;
+
+	rvlBundle_Header_t header;
+	memcpy(&header, _pMap, sizeof(header));
+	if (memcmp(header.magic, RVL_BUNDLE_MAGIC, 4) != 0 || header.version != RVL_BUNDLE_VERSION ||
+		sizeof(header) + (size_t)header.count * sizeof(rvlBundle_Entry_t) > _mapSize)
+	{
+		std::cout << "Error assetBundle open 3: Not a bundle file or wrong version" << std::endl;
+		close();
+		return rvlDisplay_FileFormat;
+	}
+	_assets = new (std::nothrow) rvlAsset_t[header.count ? header.count : 1];
+	if (_assets == nullptr)
+	{
+		std::cout << "Error assetBundle open 4: could not assign memory for index" << std::endl;
+		close();
+		return rvlDisplay_MallocError;
+	}
+	const uint8_t* pEntry = _pMap + sizeof(header);
+	for (uint16_t i = 0; i < header.count; i++, pEntry += sizeof(rvlBundle_Entry_t))
+	{
+		rvlBundle_Entry_t entry;
+		memcpy(&entry, pEntry, sizeof(entry));
+		size_t bytes = (size_t)entry.width * entry.height * 2;
+		bool sorted = (i == 0 || strncmp(_assets[i - 1].name, entry.name, RVL_BUNDLE_NAME_SIZE) < 0);
+		if (entry.name[RVL_BUNDLE_NAME_SIZE - 1] != '\0' || !sorted ||
+			entry.offset > _mapSize || bytes > _mapSize - entry.offset)
+		{
+			std::cout << "Error assetBundle open 5: Bad index entry " << i << std::endl;
+			close();
+			return rvlDisplay_FileFormat;
+		}
+		// name points into the mapping, it is null terminated in the file
+		_assets[i].name = ((const rvlBundle_Entry_t*)pEntry)->name;
+		_assets[i].width = entry.width;
+		_assets[i].height = entry.height;
+		_assets[i].data = _pMap + entry.offset;
+	}
+	_count = header.count;
+	return rvlDisplay_Success;
+}
+
+/*!
+	@brief Unmap the bundle, asset pointers from it are no longer valid
+*/
+void assetBundle::close(void)
+{
+	if (_pMap != nullptr)
+	{
+		munmap((void*)_pMap, _mapSize);
+		_pMap = nullptr;
+	}
+	delete[] _assets;
+	_assets = nullptr;
+	_mapSize = 0;
+	_count = 0;
+}
+
+/*!
+	@brief Look up an image by name
+	@param name image name, the BMP file name without extension
+	@return pointer to the asset or nullptr if not found
+	@note Binary search, the index is sorted by name when the bundle is built.
+*/
+const rvlAsset_t* assetBundle::find(const char* name) const
+{
+	if (name == nullptr) return nullptr;
+	int32_t low = 0, high = (int32_t)_count - 1;
+	while (low <= high)
+	{
+		int32_t mid = (low + high) / 2;
+		int cmp = strncmp(_assets[mid].name, name, RVL_BUNDLE_NAME_SIZE);
+		if (cmp == 0) return &_assets[mid];
+		if (cmp < 0) low = mid + 1;
+		else high = mid - 1;
+	}
+	return nullptr;
+}
+
+/*!
+	@brief Get an image by position in the index
+	@param index 0 to count()-1
+	@return pointer to the asset or nullptr if index is out of range
+*/
+const rvlAsset_t* assetBundle::at(uint16_t index) const
+{
+	return (index < _count) ? &_assets[index] : nullptr;
+}
+
+// **************** EOF *****************
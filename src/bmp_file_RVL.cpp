@@ -0,0 +1,235 @@
+/*!
+	@file     bmp_file_RVL.cpp
+	@author   Gavin Lyons
+	@brief    Streaming reader for Windows BMP image files. Project Name: ST7789_TFT_RPI
+*/
+
+#include <iostream>
+#include "../include/bmp_file_RVL.hpp"
+#include "../include/pixel_convert_RVL.hpp"
+
+// BMP header sizes and compression types, all fields are little endian
+#define BMP_FILE_HEADER_SIZE 14 /**< BITMAPFILEHEADER */
+#define BMP_INFO_HEADER_SIZE 40 /**< BITMAPINFOHEADER, smallest DIB header supported */
+#define BMP_BI_RGB 0            /**< Uncompressed */
+#define BMP_BI_BITFIELDS 3      /**< Uncompressed with color masks */
+#define BMP_BI_ALPHABITFIELDS 6 /**< Uncompressed with color and alpha masks */
+
+static inline uint16_t ReadLE16(const uint8_t* p) { return p[0] | (p[1] << 8); }
+static inline uint32_t ReadLE32(const uint8_t* p) { return p[0] | (p[1] << 8) | (p[2] << 16) | ((uint32_t)p[3] << 24); }
+
+/*!
+	@brief Destructor, closes any open file
+*/
+bmpReader::~bmpReader()
+{
+	close();
+}
+
+/*!
+	@brief Open a BMP file and parse its header
+	@param path file system path of the image
+	@return enum rvlDisplay_Return_Codes_e
+		-# rvlDisplay_Success for success
+		-# rvlDisplay_FileOpen file could not be opened
+		-# rvlDisplay_FileRead header could not be read
+		-# rvlDisplay_FileFormat not a BMP file or unsupported format
+	@note Any file already open is closed first.
+*/
+rvlDisplay_Return_Codes_e bmpReader::open(const char* path)
+{
+	close();
+	if (path == nullptr || (_pFile = fopen(path, "rb")) == nullptr)
+	{
+		std::cout << "Error bmpReader open 1: File could not be opened : " << (path ? path : "nullptr") << std::endl;
+		return rvlDisplay_FileOpen;
+	}
+	if (!readAt(0, BMP_FILE_HEADER_SIZE + BMP_INFO_HEADER_SIZE))
+	{
+		std::cout << "Error bmpReader open 2: File too short for a BMP header" << std::endl;
+		close();
+		return rvlDisplay_FileRead;
+	}
+	const uint8_t* h = _readBuffer;
+	bool signature = (h[0] == 'B' && h[1] == 'M');
+	uint32_t dataOffset = ReadLE32(h + 10);
+	uint32_t dibSize = ReadLE32(h + 14);
+	int32_t width = (int32_t)ReadLE32(h + 18);
+	int32_t height = (int32_t)ReadLE32(h + 22);
+	uint16_t planes = ReadLE16(h + 26);
+	uint16_t bpp = ReadLE16(h + 28);
+	uint32_t compression = ReadLE32(h + 30);
+	bool bitfields = (compression == BMP_BI_BITFIELDS || compression == BMP_BI_ALPHABITFIELDS);
+	// Color masks are in the header for V2 and later, straight after it for
+	// BITMAPINFOHEADER, both at file offset 54.
+	uint32_t maskR = 0, maskG = 0, maskB = 0;
+	if (bitfields)
+	{
+		if (!readAt(BMP_FILE_HEADER_SIZE + BMP_INFO_HEADER_SIZE, 12))
+		{
+			std::cout << "Error bmpReader open 2: File too short for a BMP header" << std::endl;
+			close();
+			return rvlDisplay_FileRead;
+		}
+		maskR = ReadLE32(h);
+		maskG = ReadLE32(h + 4);
+		maskB = ReadLE32(h + 8);
+	}
+
+	if (!signature)
+	{
+		std::cout << "Error bmpReader open 3: Not a BMP file" << std::endl;
+		close();
+		return rvlDisplay_FileFormat;
+	}
+	BMPFormat_e format = BMP_None;
+	if (dibSize < BMP_INFO_HEADER_SIZE || planes != 1)
+	{
+		format = BMP_None;
+	} else if (bpp == 16 && compression == BMP_BI_RGB) {
+		format = BMP_RGB555;
+	} else if (bpp == 16 && bitfields && maskR == 0xF800 && maskG == 0x07E0 && maskB == 0x001F) {
+		format = BMP_RGB565;
+	} else if (bpp == 16 && bitfields && maskR == 0x7C00 && maskG == 0x03E0 && maskB == 0x001F) {
+		format = BMP_RGB555;
+	} else if (bpp == 24 && compression == BMP_BI_RGB) {
+		format = BMP_BGR888;
+	} else if (bpp == 32 && (compression == BMP_BI_RGB ||
+		(bitfields && maskR == 0x00FF0000 && maskG == 0x0000FF00 && maskB == 0x000000FF))) {
+		format = BMP_BGRA8888;
+	}
+	if (format == BMP_None || width <= 0 || width > UINT16_MAX || height == 0 ||
+		height > UINT16_MAX || height < -UINT16_MAX)
+	{
+		std::cout << "Error bmpReader open 3: Unsupported BMP format, bpp " << bpp
+			<< " compression " << compression << std::endl;
+		close();
+		return rvlDisplay_FileFormat;
+	}
+
+	_format = format;
+	_bitsPerPixel = bpp;
+	_width = width;
+	_topDown = height < 0;
+	_height = _topDown ? -height : height;
+	_stride = (((uint32_t)_width * bpp + 31) / 32) * 4; // rows padded to 4 bytes
+	_dataOffset = dataOffset;
+	return rvlDisplay_Success;
+}
+
+/*!
+	@brief Close the file, the reader can be re-used with open
+*/
+void bmpReader::close(void)
+{
+	if (_pFile != nullptr)
+	{
+		fclose(_pFile);
+		_pFile = nullptr;
+	}
+	_format = BMP_None;
+	_width = _height = 0;
+	_bitsPerPixel = 0;
+}
+
+/*!
+	@brief Read a band of rows, converted to big endian RGB565
+	@param row first row to read, 0 is the top of the image whatever the file order
+	@param rows number of rows to read
+	@param x first column to read
+	@param w number of columns to read
+	@param pDst destination, receives rows * w * 2 bytes, rows top down
+	@return enum rvlDisplay_Return_Codes_e
+		-# rvlDisplay_Success for success
+		-# rvlDisplay_BitmapNullptr no file open or pDst is nullptr
+		-# rvlDisplay_BitmapScreenBounds requested area is outside the image
+		-# rvlDisplay_FileRead file read failed
+	@details The stored rows of a band are next to each other in the file in
+		either order, so when they fit the read buffer the band is one read.
+		Otherwise each row is read on its own, in pieces if needed.
+*/
+rvlDisplay_Return_Codes_e bmpReader::readRows(uint16_t row, uint16_t rows, uint16_t x, uint16_t w, uint8_t* pDst)
+{
+	if (_pFile == nullptr || pDst == nullptr)
+	{
+		std::cout << "Error bmpReader readRows 1: No file open or buffer is nullptr" << std::endl;
+		return rvlDisplay_BitmapNullptr;
+	}
+	if ((uint32_t)row + rows > _height || (uint32_t)x + w > _width)
+	{
+		std::cout << "Error bmpReader readRows 2: Rows or columns outside image" << std::endl;
+		return rvlDisplay_BitmapScreenBounds;
+	}
+	if (rows == 0 || w == 0) return rvlDisplay_Success;
+
+	const uint32_t pixelBytes = _bitsPerPixel / 8;
+	const uint32_t xOffset = x * pixelBytes;
+	const uint32_t spanBytes = w * pixelBytes;
+	// Index in the file of the first stored row of the band
+	const uint32_t firstStored = _topDown ? row : _height - row - rows;
+	const uint32_t bandBytes = (rows - 1) * _stride + spanBytes;
+
+	if (bandBytes <= RVL_BMP_READ_BUFFER_SIZE)
+	{
+		if (!readAt(_dataOffset + firstStored * _stride + xOffset, bandBytes))
+		{
+			std::cout << "Error bmpReader readRows 3: File read failed" << std::endl;
+			return rvlDisplay_FileRead;
+		}
+		for (uint16_t j = 0; j < rows; j++)
+		{
+			uint32_t stored = _topDown ? j : rows - 1 - j;
+			convertRow(_readBuffer + stored * _stride, pDst + j * w * 2, w);
+		}
+		return rvlDisplay_Success;
+	}
+
+	const uint32_t chunkPixels = RVL_BMP_READ_BUFFER_SIZE / pixelBytes;
+	for (uint16_t j = 0; j < rows; j++)
+	{
+		uint32_t stored = _topDown ? row + j : _height - 1 - (row + j);
+		for (uint32_t done = 0; done < w; done += chunkPixels)
+		{
+			uint32_t pixels = (w - done < chunkPixels) ? w - done : chunkPixels;
+			if (!readAt(_dataOffset + stored * _stride + xOffset + done * pixelBytes, pixels * pixelBytes))
+			{
+				std::cout << "Error bmpReader readRows 3: File read failed" << std::endl;
+				return rvlDisplay_FileRead;
+			}
+			convertRow(_readBuffer, pDst + (j * w + done) * 2, pixels);
+		}
+	}
+	return rvlDisplay_Success;
+}
+
+/*!
+	@brief Convert one row from the file's pixel format to big endian RGB565
+	@param pSrc raw pixels
+	@param pDst converted pixels
+	@param pixels number of pixels
+*/
+void bmpReader::convertRow(const uint8_t* pSrc, uint8_t* pDst, uint32_t pixels)
+{
+	switch (_format)
+	{
+		case BMP_RGB565: ConvertRGB565LEtoBE(pSrc, pDst, pixels); break;
+		case BMP_RGB555: ConvertRGB555LEtoRGB565BE(pSrc, pDst, pixels); break;
+		case BMP_BGR888: ConvertBGR888toRGB565BE(pSrc, pDst, pixels); break;
+		case BMP_BGRA8888: ConvertBGRA8888toRGB565BE(pSrc, pDst, pixels); break;
+		case BMP_None: break;
+	}
+}
+
+/*!
+	@brief Read len bytes at file offset into the read buffer
+	@param offset byte offset from start of file
+	@param len number of bytes, at most RVL_BMP_READ_BUFFER_SIZE
+	@return true on success, false on seek error or short read
+*/
+bool bmpReader::readAt(uint32_t offset, uint32_t len)
+{
+	if (fseek(_pFile, offset, SEEK_SET) != 0) return false;
+	return fread(_readBuffer, 1, len, _pFile) == len;
+}
+
+// **************** EOF *****************
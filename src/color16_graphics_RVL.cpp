@@ -5,6 +5,10 @@
 				This file handles the graphic methods
 */
 
+#include <cstring>
+#include <chrono>
+#include <thread>
+#include <sys/stat.h>
 #include "../include/color16_graphics_RVL.hpp"
 
 
@@ -18,9 +22,11 @@ color16_graphics::color16_graphics(){}
 	@param x  Column co-ord
 	@param y  row co-ord
 	@param color 565 16-bit
+	@note Pixels outside the clip rectangle are ignored
 */
-void color16_graphics::drawPixel(uint16_t x, uint16_t y, uint16_t color) {
-	if ((x >= _width) || (y >= _height))
+void color16_graphics::drawPixel(int16_t x, int16_t y, uint16_t color) {
+	int32_t x0 = x, y0 = y, x1 = x, y1 = y;
+	if (!clipWindow(x0, y0, x1, y1))
 	{
 		return;
 	}
@@ -37,50 +43,25 @@ void color16_graphics::drawPixel(uint16_t x, uint16_t y, uint16_t color) {
 	@param w width of the rectangle
 	@param h height of the rectangle
 	@param color color to fill  rectangle 565 16-bit
-	@note  uses spiWriteDataBuffer method
+	@note  One address window, pixels streamed from the scratch buffer.
+		The rectangle is trimmed to the clip rectangle, nothing is drawn if it lies outside.
 	@return enum rvlDisplay_Return_Codes_e 
 		-# rvlDisplay_Success for success
-		-# rvlDisplay_ShapeScreenBounds Error
-		-# rvlDisplay_MallocError Error
+		-# rvlDisplay_ShapeScreenBounds Error, no part inside the clip rectangle
 */
-rvlDisplay_Return_Codes_e color16_graphics::fillRectangle(uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t color) {
-	uint8_t hi, lo;
-
-	// Check bounds
-	if ((x >= _width) || (y >= _height))
+rvlDisplay_Return_Codes_e color16_graphics::fillRectangle(int16_t x, int16_t y, uint16_t w, uint16_t h, uint16_t color) {
+	if (!fillRectWindow(x, y, w, h, color))
 	{
 		std::cout << "Error fillRectangle 2: Out of screen bounds" << std::endl;
 		return rvlDisplay_ShapeScreenBounds;
 	}
-	if ((x + w - 1) >= _width) w = _width - x;
-	if ((y + h - 1) >= _height) h = _height - y;
-
-	// Colour to bytes
-	hi = color >> 8;
-	lo = color;
-
-	// Create bitmap buffer
-	uint8_t* buffer = (uint8_t*)malloc(w*h*sizeof(uint16_t));
-	if (buffer == nullptr) // check malloc
-	{
-		std::cout << "Error fillRectangle 3: MALLOC could not assign memory " << std::endl;
-		return rvlDisplay_MallocError;
-	}
-	for(uint32_t i = 0; i<w*h*sizeof(uint16_t);) {
-		buffer[i++] = hi;
-		buffer[i++] = lo;
-	}
-
-	// Set window and write buffer
-	setAddrWindow(x, y, x + w - 1, y + h - 1);
-	spiWriteDataBuffer(buffer, h*w*sizeof(uint16_t));
-	free(buffer);
 	return rvlDisplay_Success;
 }
 
 /*!
 	@brief Fills the whole screen with a given color.
 	@param  color 565 16-bit
+	@note Only the area inside the clip rectangle is filled
 */
 void color16_graphics::fillScreen(uint16_t color) {
 	fillRectangle(0, 0, _width, _height, color);
@@ -94,25 +75,11 @@ void color16_graphics::fillScreen(uint16_t color) {
 	@param color The color of the line 565 16 Bit color
 	@return enum rvlDisplay_Return_Codes_e 
 		-# rvlDisplay_Success for success
-		-# rvlDisplay_ShapeScreenBounds Error
+		-# rvlDisplay_ShapeScreenBounds Error, no part inside the clip rectangle
 */
-rvlDisplay_Return_Codes_e color16_graphics::drawFastVLine(uint16_t x, uint16_t y, uint16_t h, uint16_t color) {
-	uint8_t hi, lo;
-	if ((x >= _width) || (y >= _height))
+rvlDisplay_Return_Codes_e color16_graphics::drawFastVLine(int16_t x, int16_t y, uint16_t h, uint16_t color) {
+	if (!fillRectWindow(x, y, 1, h, color))
 		return rvlDisplay_ShapeScreenBounds;
-	if ((y + h - 1) >= _height)
-		h = _height - y;
-	hi = color >> 8;
-	lo = color;
-	setAddrWindow(x, y, x, y + h - 1);
-	DisplayRVL_DC_SetHigh;
-
-	if (_hardwareSPI == false){DisplayRVL_CS_SetLow;}
-	while (h--) {
-		spiWrite(hi);
-		spiWrite(lo);
-	}
-	if (_hardwareSPI == false){DisplayRVL_CS_SetHigh;}
 	return rvlDisplay_Success;
 }
 
@@ -124,24 +91,11 @@ rvlDisplay_Return_Codes_e color16_graphics::drawFastVLine(uint16_t x, uint16_t y
 	@param color The color of the line 565 16 Bit color
 	@return enum rvlDisplay_Return_Codes_e 
 		-# rvlDisplay_Success for success
-		-# rvlDisplay_ShapeScreenBounds Error
+		-# rvlDisplay_ShapeScreenBounds Error, no part inside the clip rectangle
 */
-rvlDisplay_Return_Codes_e color16_graphics::drawFastHLine(uint16_t x, uint16_t y, uint16_t w, uint16_t color) {
-	uint8_t hi, lo;
-	if ((x >= _width) || (y >= _height))
+rvlDisplay_Return_Codes_e color16_graphics::drawFastHLine(int16_t x, int16_t y, uint16_t w, uint16_t color) {
+	if (!fillRectWindow(x, y, w, 1, color))
 		return rvlDisplay_ShapeScreenBounds;
-	if ((x + w - 1) >= _width)
-		w = _width - x;
-	hi = color >> 8;
-	lo = color;
-	setAddrWindow(x, y, x + w - 1, y);
-	DisplayRVL_DC_SetHigh;
-	if (_hardwareSPI == false){DisplayRVL_CS_SetLow;}
-	while (w--) {
-		spiWrite(hi);
-		spiWrite(lo);
-	}
-	if (_hardwareSPI == false){DisplayRVL_CS_SetHigh;}
 	return rvlDisplay_Success;
 }
 
@@ -154,6 +108,8 @@ rvlDisplay_Return_Codes_e color16_graphics::drawFastHLine(uint16_t x, uint16_t y
 */
 void color16_graphics::drawCircle(int16_t x0, int16_t y0, int16_t r, uint16_t color) {
 	int16_t f, ddF_x, ddF_y, x, y;
+	int32_t bx0 = x0 - r, by0 = y0 - r, bx1 = x0 + r, by1 = y0 + r;
+	if (!clipWindow(bx0, by0, bx1, by1)) return;
 	f = 1 - r, ddF_x = 1, ddF_y = -2 * r, x = 0, y = r;
 	drawPixel(x0, y0 + r, color);
 	drawPixel(x0, y0 - r, color);
@@ -214,29 +170,51 @@ void color16_graphics::drawCircleHelper(int16_t x0, int16_t y0, int16_t r, uint8
 }
 
 /*!
-	@brief Used internally by fill circle fillRoundRect and fillcircle
+	@brief Used internally by fillCircle and fillRoundRect, appends the
+		horizontal spans of a filled rectangle with rounded corners to _spanList.
+	@param x x start coordinate
+	@param y y start coordinate
+	@param w width of the rectangle
+	@param h height of the rectangle
+	@param r radius of the rounded corners
+	@note  The corner outline follows the same midpoint circle walk as drawCircleHelper.
 */
-void color16_graphics::fillCircleHelper(int16_t x0, int16_t y0, int16_t r, uint8_t cornername, int16_t delta, uint16_t color) {
-	int16_t f, ddF_x, ddF_y, x, y;
-	f = 1 - r, ddF_x = 1, ddF_y = -2 * r, x = 0, y = r;
-	while (x < y) {
+void color16_graphics::roundRectSpans(int16_t x, int16_t y, int16_t w, int16_t h, int16_t r) {
+	int16_t f, ddF_x, ddF_y, cx, cy, dy;
+	if (w <= 0 || h <= 0) return;
+	if (r < 0) r = 0;
+	// halfWidth[dy] = how far the corner reaches out from its centre column, dy rows from its centre row
+	_cornerWidth.assign(r + 2, 0);
+	int16_t* halfWidth = _cornerWidth.data();
+	f = 1 - r, ddF_x = 1, ddF_y = -2 * r, cx = 0, cy = r;
+	while (cx < cy) {
 		if (f >= 0) {
-			y--;
+			cy--;
 			ddF_y += 2;
 			f += ddF_y;
 		}
-		x++;
+		cx++;
 		ddF_x += 2;
 		f += ddF_x;
+		if (halfWidth[cy] < cx) halfWidth[cy] = cx;
+		if (halfWidth[cx] < cy) halfWidth[cx] = cy;
+	}
+	for (dy = r - 1; dy >= 0; dy--) {
+		if (halfWidth[dy] < halfWidth[dy + 1]) halfWidth[dy] = halfWidth[dy + 1];
+	}
 
-		if (cornername & 0x1) {
-			drawFastVLine(x0 + x, y0 - y, 2 * y + 1 + delta, color);
-			drawFastVLine(x0 + y, y0 - x, 2 * x + 1 + delta, color);
-		}
-		if (cornername & 0x2) {
-			drawFastVLine(x0 - x, y0 - y, 2 * y + 1 + delta, color);
-			drawFastVLine(x0 - y, y0 - x, 2 * x + 1 + delta, color);
-		}
+	int16_t left = x + r;          // centre column of left corners
+	int16_t right = x + w - r - 1; // centre column of right corners
+	int16_t top = y + r;           // centre row of top corners
+	int16_t bottom = y + h - r - 1;// centre row of bottom corners
+	for (dy = r; dy > 0; dy--) {
+		_spanList.push_back({(int16_t)(left - halfWidth[dy]), (int16_t)(top - dy), (int16_t)(right - left + 1 + 2 * halfWidth[dy])});
+	}
+	for (int16_t row = top; row <= bottom; row++) {
+		_spanList.push_back({(int16_t)(left - halfWidth[0]), row, (int16_t)(right - left + 1 + 2 * halfWidth[0])});
+	}
+	for (dy = 1; dy <= r; dy++) {
+		_spanList.push_back({(int16_t)(left - halfWidth[dy]), (int16_t)(bottom + dy), (int16_t)(right - left + 1 + 2 * halfWidth[dy])});
 	}
 }
 
@@ -248,8 +226,11 @@ void color16_graphics::fillCircleHelper(int16_t x0, int16_t y0, int16_t r, uint8
 	@param color color of the circle , 565 16 Bit color
 */
 void color16_graphics ::fillCircle(int16_t x0, int16_t y0, int16_t r, uint16_t color) {
-	drawFastVLine(x0, y0 - r, 2 * r + 1, color);
-	fillCircleHelper(x0, y0, r, 3, 0, color);
+	int32_t bx0 = x0 - r, by0 = y0 - r, bx1 = x0 + r, by1 = y0 + r;
+	if (!clipWindow(bx0, by0, bx1, by1)) return;
+	_spanList.clear();
+	roundRectSpans(x0 - r, y0 - r, 2 * r + 1, 2 * r + 1, r);
+	fillSpans(_spanList.data(), _spanList.size(), color);
 }
 
 /*!
@@ -260,7 +241,7 @@ void color16_graphics ::fillCircle(int16_t x0, int16_t y0, int16_t r, uint16_t c
 	@param h height of the rectangle
 	@param color color to fill  rectangle 565 16-bit
 */
-void color16_graphics::drawRectWH(uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t color) {
+void color16_graphics::drawRectWH(int16_t x, int16_t y, uint16_t w, uint16_t h, uint16_t color) {
 	drawFastHLine(x, y, w, color);
 	drawFastHLine(x, y + h - 1, w, color);
 	drawFastVLine(x, y, h, color);
@@ -274,9 +255,13 @@ void color16_graphics::drawRectWH(uint16_t x, uint16_t y, uint16_t w, uint16_t h
 	@param x1 x end coordinate
 	@param y1 y end coordinate
 	@param color color to fill  rectangle 565 16-bit
+	@note Each straight run of the Bresenham walk is sent as one
+		drawFastHLine/drawFastVLine window rather than pixel by pixel.
 */
 void color16_graphics::drawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color) {
-	int16_t steep, dx, dy, err, ystep;
+	int16_t steep, dx, dy, err, ystep, runStart;
+	int32_t bx0 = std::min(x0, x1), by0 = std::min(y0, y1), bx1 = std::max(x0, x1), by1 = std::max(y0, y1);
+	if (!clipWindow(bx0, by0, bx1, by1)) return;
 	steep = abs(y1 - y0) > abs(x1 - x0);
 	if (steep) {
 		_swap_int16_t_RVL(x0, y0);
@@ -296,18 +281,35 @@ void color16_graphics::drawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1,
 		ystep = -1;
 	}
 
+	runStart = x0;
 	for (; x0 <= x1; x0++) {
-		if (steep) {
-			drawPixel(y0, x0, color);
-		} else {
-			drawPixel(x0, y0, color);
-		}
 		err -= dy;
 		if (err < 0) {
+			drawLineRun(steep, runStart, x0, y0, color);
+			runStart = x0 + 1;
 			y0 += ystep;
 			err += dx;
 		}
 	}
+	if (runStart <= x1) {
+		drawLineRun(steep, runStart, x1, y0, color);
+	}
+}
+
+/*!
+	@brief Used internally by drawLine, draws one straight run of a line
+	@param steep true if the line is steep, run is then vertical
+	@param start first pixel of run along the major axis
+	@param end last pixel of run along the major axis
+	@param minor position of run along the minor axis
+	@param color color of the line 565 16-bit
+*/
+void color16_graphics::drawLineRun(bool steep, int16_t start, int16_t end, int16_t minor, uint16_t color) {
+	if (steep) {
+		drawFastVLine(minor, start, end - start + 1, color);
+	} else {
+		drawFastHLine(start, minor, end - start + 1, color);
+	}
 }
 
 /*!
@@ -318,11 +320,8 @@ void color16_graphics::drawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1,
 	@param h height of the rectangle
 	@param color color to fill  rectangle 565 16-bit
 */
-void color16_graphics ::fillRect(uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t color) {
-	int16_t i;
-	for (i = x; i < x + w; i++) {
-		drawFastVLine(i, y, h, color);
-	}
+void color16_graphics ::fillRect(int16_t x, int16_t y, uint16_t w, uint16_t h, uint16_t color) {
+	fillRectWindow(x, y, w, h, color);
 }
 
 /*!
@@ -334,7 +333,9 @@ void color16_graphics ::fillRect(uint16_t x, uint16_t y, uint16_t w, uint16_t h,
 	@param r r: radius of the rounded edges
 	@param color color to fill  rectangle 565 16-bit
 */
-void color16_graphics::drawRoundRect(uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t r, uint16_t color) {
+void color16_graphics::drawRoundRect(int16_t x, int16_t y, uint16_t w, uint16_t h, uint16_t r, uint16_t color) {
+	int32_t bx0 = x, by0 = y, bx1 = x + w - 1, by1 = y + h - 1;
+	if (!clipWindow(bx0, by0, bx1, by1)) return;
 	drawFastHLine(x + r, y, w - 2 * r, color);
 	drawFastHLine(x + r, y + h - 1, w - 2 * r, color);
 	drawFastVLine(x, y + r, h - 2 * r, color);
@@ -351,13 +352,18 @@ void color16_graphics::drawRoundRect(uint16_t x, uint16_t y, uint16_t w, uint16_
 	@param y y start coordinate
 	@param w width of the rectangle
 	@param h height of the rectangle
-	@param r r: radius of the rounded edges
+	@param r r: radius of the rounded edges, limited to half the shorter side
 	@param color color to fill  rectangle 565 16-bit
 */
-void color16_graphics::fillRoundRect(uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t r, uint16_t color) {
-	fillRect(x + r, y, w - 2 * r, h, color);
-	fillCircleHelper(x + w - r - 1, y + r, r, 1, h - 2 * r - 1, color);
-	fillCircleHelper(x + r, y + r, r, 2, h - 2 * r - 1, color);
+void color16_graphics::fillRoundRect(int16_t x, int16_t y, uint16_t w, uint16_t h, uint16_t r, uint16_t color) {
+	int32_t bx0 = x, by0 = y, bx1 = x + w - 1, by1 = y + h - 1;
+	if (!clipWindow(bx0, by0, bx1, by1)) return;
+	// Corners wider than the rectangle would put spans outside it
+	const uint16_t maxRadius = std::min(w, h) / 2;
+	if (r > maxRadius) r = maxRadius;
+	_spanList.clear();
+	roundRectSpans(x, y, w, h, r);
+	fillSpans(_spanList.data(), _spanList.size(), color);
 }
 
 
@@ -388,7 +394,12 @@ void color16_graphics ::drawTriangle(int16_t x0, int16_t y0, int16_t x1, int16_t
 	@param color color to fill , 565 16-bit
 */
 void color16_graphics::fillTriangle(int16_t x0, int16_t y0, int16_t x1, int16_t y1, int16_t x2, int16_t y2, uint16_t color) {
-	int16_t a, b, y, last, dx01, dy01, dx02, dy02, dx12, dy12, sa, sb;
+	int16_t a, b, y, last;
+	// Edge steps in 32 bits, dx * dy of a screen sized triangle overflows 16
+	int32_t dx01, dy01, dx02, dy02, dx12, dy12, sa, sb;
+	int32_t bx0 = std::min({x0, x1, x2}), by0 = std::min({y0, y1, y2});
+	int32_t bx1 = std::max({x0, x1, x2}), by1 = std::max({y0, y1, y2});
+	if (!clipWindow(bx0, by0, bx1, by1)) return;
 	// Sort coordinates by Y order (y2 >= y1 >= y0)
 	if (y0 > y1) {
 		_swap_int16_t_RVL(y0, y1);
@@ -411,6 +422,7 @@ void color16_graphics::fillTriangle(int16_t x0, int16_t y0, int16_t x1, int16_t
 		drawFastHLine(a, y0, b - a + 1, color);
 		return;
 	}
+	_spanList.clear();
 	dx01 = x1 - x0;
 	dy01 = y1 - y0;
 	dx02 = x2 - x0;
@@ -427,7 +439,7 @@ void color16_graphics::fillTriangle(int16_t x0, int16_t y0, int16_t x1, int16_t
 		sa += dx01;
 		sb += dx02;
 		if (a > b) _swap_int16_t_RVL(a, b);
-		drawFastHLine(a, y, b - a + 1, color);
+		_spanList.push_back({a, y, (int16_t)(b - a + 1)});
 	}
 
 	sa = dx12 * (y - y1);
@@ -438,8 +450,9 @@ void color16_graphics::fillTriangle(int16_t x0, int16_t y0, int16_t x1, int16_t
 		sa += dx12;
 		sb += dx02;
 		if (a > b) _swap_int16_t_RVL(a, b);
-		drawFastHLine(a, y, b - a + 1, color);
+		_spanList.push_back({a, y, (int16_t)(b - a + 1)});
 	}
+	fillSpans(_spanList.data(), _spanList.size(), color);
 }
 
 
@@ -454,37 +467,44 @@ void color16_graphics::fillTriangle(int16_t x0, int16_t y0, int16_t x1, int16_t
 	@param character  An array of unsigned chars containing icon data vertically addressed.
 	@return enum rvlDisplay_Return_Codes_e 
 		-# rvlDisplay_Success for success
-		-# rvlDisplay_BitmapScreenBounds Error
 		-# rvlDisplay_BitmapNullptr Error
+	@note The icon is trimmed to the clip rectangle, x and y may be negative.
+		Each visible row is packed into horizontal bytes then expanded with
+		ConvertMono1toRGB565BE into the scratch buffer, the icon is sent in
+		one address window. Set bits are drawn in backcolor, clear bits in color.
 */
-rvlDisplay_Return_Codes_e color16_graphics::drawIcon(uint16_t x, uint16_t y, uint16_t w, uint16_t color, uint16_t backcolor, const unsigned char character[]) {
-	// Out of screen bounds
-	if ((x >= _width) || (y >= _height))
-	{
-		std::cout << "Error drawIcon 2: Out of screen bounds" << std::endl;
-		return rvlDisplay_BitmapScreenBounds ;
-	}
+rvlDisplay_Return_Codes_e color16_graphics::drawIcon(int16_t x, int16_t y, uint16_t w, uint16_t color, uint16_t backcolor, const unsigned char character[]) {
 	// Check for null pointer
 	if(character == nullptr)
 	{
 		std::cout << "Error drawIcon 3: Icon array is not valid pointer object" << std::endl;
 		return rvlDisplay_BitmapNullptr;
 	}
-	uint8_t value;
-	for (uint8_t byte = 0; byte < w; byte++)
+	// Trim to clip rectangle
+	int32_t x0 = x, y0 = y, x1 = x + w - 1, y1 = y + 7;
+	if (w == 0 || !clipWindow(x0, y0, x1, y1)) return rvlDisplay_Success;
+	const uint16_t srcX = x0 - x, srcY = y0 - y;
+	const uint16_t clipW = x1 - x0 + 1, clipH = y1 - y0 + 1;
+
+	// Column bytes to rows of horizontal bytes, most significant bit first
+	const rvlMono1LUT_t& lut = mono1LUT(backcolor, color);
+	const uint32_t rowBytes = clipW * 2;
+	const uint16_t bandRows = RVL_SCRATCH_BUFFER_SIZE / rowBytes;
+	uint8_t packed[(RVL_SCRATCH_BUFFER_SIZE / 2 + 7) / 8];
+	_scratchColor = -1;
+	setAddrWindow(x0, y0, x1, y1);
+	for (uint16_t row = 0; row < clipH; row += bandRows)
 	{
-		for (uint8_t mybit = 0; mybit < 8; mybit++)
+		uint16_t rows = std::min<uint16_t>(bandRows, clipH - row);
+		for (uint16_t j = 0; j < rows; j++)
 		{
-			value = !!(character[byte]& (1 << mybit));
-			if (value)
-			{
-				drawPixel(x + byte, y + mybit, backcolor);
-			} else
-			{
-				drawPixel(x + byte, y + mybit, color);
-			}
-			value = 0;
+			const uint8_t mask = 1 << (srcY + row + j);
+			memset(packed, 0, (clipW + 7) / 8);
+			for (uint16_t i = 0; i < clipW; i++)
+				if (character[srcX + i] & mask) packed[i / 8] |= 0x80 >> (i & 7);
+			ConvertMono1toRGB565BE(packed, 0, _scratchBuffer + j * rowBytes, clipW, lut);
 		}
+		spiWriteDataBuffer(_scratchBuffer, rows * rowBytes);
 	}
 	return rvlDisplay_Success;
 }
@@ -500,16 +520,15 @@ rvlDisplay_Return_Codes_e color16_graphics::drawIcon(uint16_t x, uint16_t y, uin
 	@param pBmp  an array of unsigned chars containing bitmap data horizontally addressed.
 	@return enum rvlDisplay_Return_Codes_e 
 		-# rvlDisplay_Success for success
-		-# rvlDisplay_BitmapScreenBounds Error
 		-# rvlDisplay_BitmapNullptr Error
 		-# rvlDisplay_BitmapHorizontalSize Error
-		-# rvlDisplay_MallocError Error
+	@note The bitmap is trimmed to the clip rectangle, x and y may be negative.
+		Rows are expanded with ConvertMono1toRGB565BE, one 16 byte table copy per
+		source byte, a band of rows at a time into the scratch buffer. The table
+		is kept between calls and only rebuilt when the colors change.
 */
-rvlDisplay_Return_Codes_e color16_graphics::drawBitmap(uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t color, uint16_t bgcolor, const uint8_t* pBmp) {
+rvlDisplay_Return_Codes_e color16_graphics::drawBitmap(int16_t x, int16_t y, uint16_t w, uint16_t h, uint16_t color, uint16_t bgcolor, const uint8_t* pBmp) {
 	int16_t byteWidth = (w + 7) / 8;
-	uint8_t byte = 0;
-	uint16_t mycolor = 0;
-	uint32_t ptr;
 
 	if( pBmp == nullptr) //  Check for null pointer
 	{
@@ -521,45 +540,45 @@ rvlDisplay_Return_Codes_e color16_graphics::drawBitmap(uint16_t x, uint16_t y, u
 		std::cout << ("Error drawBitmap 2 : Horizontal Bitmap size is incorrect:  Check Size = w % 8 != 0: ")<< w << std::endl;
 		return rvlDisplay_BitmapHorizontalSize;
 	}
-	if ((x >= _width) || (y >= _height)) // Check bounds
-	{
-		std::cout << "Error drawBitmap 3: Out of screen bounds, check x & y" << std::endl;
-		return rvlDisplay_BitmapScreenBounds;
-	}
-
-	if ((x + w - 1) >= _width) w = _width - x;
-	if ((y + h - 1) >= _height) h = _height - y;
-
-	// Create bitmap buffer
-	uint8_t* buffer = (uint8_t*)malloc(w * h * 2);
-	if (buffer == nullptr) // check malloc
+	// Trim to clip rectangle
+	int32_t x0 = x, y0 = y, x1 = x + w - 1, y1 = y + h - 1;
+	if (!clipWindow(x0, y0, x1, y1)) return rvlDisplay_Success;
+	uint16_t srcX = x0 - x, srcY = y0 - y;
+	uint16_t clipW = x1 - x0 + 1, clipH = y1 - y0 + 1;
+
+	// Expand and send a band of rows at a time through the scratch buffer
+	const rvlMono1LUT_t& lut = mono1LUT(color, bgcolor);
+	const uint32_t rowBytes = clipW * 2;
+	const uint16_t bandRows = RVL_SCRATCH_BUFFER_SIZE / rowBytes;
+	_scratchColor = -1;
+	setAddrWindow(x0, y0, x1, y1);
+	for (uint16_t row = 0; row < clipH; row += bandRows)
 	{
-		std::cout << "Error drawBitmap 3: MALLOC could not assign memory " << std::endl;
-		return rvlDisplay_MallocError;
-	}
-	ptr = 0;
-
-	for (uint16_t j = 0; j < h; j++)
-	{
-		for (uint16_t i = 0; i < w; i++)
+		uint16_t rows = std::min<uint16_t>(bandRows, clipH - row);
+		for (uint16_t j = 0; j < rows; j++)
 		{
-			if (i & 7)
-				byte <<= 1;
-			else
-				byte = (pBmp[j * byteWidth + i / 8]);
-			mycolor = (byte & 0x80) ? color : bgcolor;
-			buffer[ptr++] = mycolor >> 8;
-			buffer[ptr++] = mycolor;
+			const uint8_t* pSrcRow = pBmp + (uint32_t)(srcY + row + j) * byteWidth + srcX / 8;
+			ConvertMono1toRGB565BE(pSrcRow, srcX & 7, _scratchBuffer + j * rowBytes, clipW, lut);
 		}
+		spiWriteDataBuffer(_scratchBuffer, rows * rowBytes);
 	}
-	// Set window and write buffer
-	setAddrWindow(x, y, x + w - 1, y + h - 1);
-	spiWriteDataBuffer(buffer, h*w*sizeof(uint16_t));
-
-	free(buffer);
 	return rvlDisplay_Success;
 }
 
+/*!
+	@brief Get the 1 bit bitmap expansion table for a color pair, rebuilt only
+		when the colors differ from the last call
+	@param color color of set bits
+	@param bgcolor color of clear bits
+	@return table for ConvertMono1toRGB565BE
+*/
+const rvlMono1LUT_t& color16_graphics::mono1LUT(uint16_t color, uint16_t bgcolor)
+{
+	if (!_mono1LUT.valid || _mono1LUT.color != color || _mono1LUT.bgcolor != bgcolor)
+		BuildMono1LUT(_mono1LUT, color, bgcolor);
+	return _mono1LUT;
+}
+
 /*!
 	@brief Draws an 24 bit color bitmap to screen from a data array
 	@param x X coordinate
@@ -569,56 +588,47 @@ rvlDisplay_Return_Codes_e color16_graphics::drawBitmap(uint16_t x, uint16_t y, u
 	@param h height of the bitmap in pixels
 	@return enum rvlDisplay_Return_Codes_e 
 		-# rvlDisplay_Success for success
-		-# rvlDisplay_BitmapScreenBounds Error
 		-# rvlDisplay_BitmapNullptr Error
-		-# rvlDisplay_MallocError Error
-	@note 24 bit color converted to 16 bit color
+	@note 24 bit color (BGR byte order, rows bottom up as in a BMP file) converted
+		to 16 bit color with ConvertBGR888toRGB565BE, a band of rows at a time
+		into the scratch buffer. The bitmap is trimmed to the clip rectangle,
+		x and y may be negative. With an image cache attached (setImageCache)
+		the whole bitmap is converted once and later draws send the cached copy.
 */
-rvlDisplay_Return_Codes_e  color16_graphics::drawBitmap24(uint16_t x, uint16_t y, uint8_t *pBmp, uint16_t w, uint16_t h)
+rvlDisplay_Return_Codes_e  color16_graphics::drawBitmap24(int16_t x, int16_t y, uint8_t *pBmp, uint16_t w, uint16_t h)
 {
-	uint16_t i, j;
-	uint16_t color;
-	uint32_t rgb, ptr;
 	// 1. Check for null pointer
 	if( pBmp == nullptr)
 	{
 		std::cout << "Error drawBitmap24 1: Bitmap array is nullptr" << std::endl;
 		return rvlDisplay_BitmapNullptr;
 	}
-	// Check bounds
-	if ((x >= _width) || (y >= _height))
+	// Trim to clip rectangle
+	int32_t x0 = x, y0 = y, x1 = x + w - 1, y1 = y + h - 1;
+	if (!clipWindow(x0, y0, x1, y1)) return rvlDisplay_Success;
+	if (_imageCache != nullptr)
 	{
-		std::cout << "Error drawBitmap24 2: Out of screen bounds" << std::endl;
-		return rvlDisplay_BitmapScreenBounds;
+		const uint8_t* pCached = cachedBitmap(pBmp, w, h, 24);
+		if (pCached != nullptr) return drawBitmap565(x, y, pCached, w, h);
 	}
-	if ((x + w - 1) >= _width) w = _width - x;
-	if ((y + h - 1) >= _height) h = _height - y;
-
-	// Create bitmap buffer
-	uint8_t* buffer = (uint8_t*)malloc(w * h * 2);
-	if (buffer == nullptr) // check malloc
-	{
-		std::cout << "Error drawBitmap24 3: MALLOC could not assign memory " << std::endl;
-		return rvlDisplay_MallocError;
-	}
-	ptr = 0;
-	for(j = 0; j < h; j++)
+	uint16_t srcX = x0 - x, srcY = y0 - y;
+	uint16_t clipW = x1 - x0 + 1, clipH = y1 - y0 + 1;
+
+	// Convert and send a band of rows at a time through the scratch buffer
+	const uint32_t rowBytes = clipW * 2;
+	const uint16_t bandRows = RVL_SCRATCH_BUFFER_SIZE / rowBytes;
+	_scratchColor = -1;
+	setAddrWindow(x0, y0, x1, y1);
+	for (uint16_t row = 0; row < clipH; row += bandRows)
 	{
-		for(i = 0; i < w ; i ++)
+		uint16_t rows = std::min<uint16_t>(bandRows, clipH - row);
+		for (uint16_t j = 0; j < rows; j++)
 		{
-			// Translate RBG24 to RGB565 bitmap
-			rgb = *(unsigned int*)(pBmp + i * 3 + (h-1-j) * 3 * w);
-			color = Color565(((rgb >> 16) & 0xFF), ((rgb >> 8) & 0xFF), (rgb & 0xFF));
-			buffer[ptr++] = color >> 8;
-			buffer[ptr++] = color;
+			const uint8_t* pSrcRow = pBmp + ((uint32_t)(h - 1 - (srcY + row + j)) * w + srcX) * 3;
+			ConvertBGR888toRGB565BE(pSrcRow, _scratchBuffer + j * rowBytes, clipW);
 		}
+		spiWriteDataBuffer(_scratchBuffer, rows * rowBytes);
 	}
-
-	// Set window and write buffer
-	setAddrWindow(x, y, x + w - 1, y + h - 1);
-	spiWriteDataBuffer(buffer, h*w*sizeof(uint16_t));
-
-	free(buffer);
 	return rvlDisplay_Success;
 }
 
@@ -630,58 +640,634 @@ rvlDisplay_Return_Codes_e  color16_graphics::drawBitmap24(uint16_t x, uint16_t y
 	@param pBmp A pointer to the databuffer containing Bitmap data
 	@param w width of the bitmap in pixels
 	@param h height of the bitmap in pixels
+	@param bigEndianTopDown false(default) data is little endian 565 with rows bottom up
+		as in a BMP file. true data is already big endian (display order) with rows
+		top down, it is sent straight to the display with no copy, see drawBitmap565.
 	@return enum rvlDisplay_Return_Codes_e 
 		-# rvlDisplay_Success for success
-		-# rvlDisplay_BitmapScreenBounds Error
 		-# rvlDisplay_BitmapNullptr Error
-		-# rvlDisplay_MallocError Error
+	@note The bitmap is trimmed to the clip rectangle, x and y may be negative.
+		BMP order data is byte swapped with ConvertRGB565LEtoBE a band of rows
+		at a time into the scratch buffer, or once into the image cache if one
+		is attached (setImageCache).
 */
-rvlDisplay_Return_Codes_e  color16_graphics::drawBitmap16(uint16_t x, uint16_t y, uint8_t *pBmp, uint16_t w, uint16_t h) {
-	uint16_t i, j;
-	uint16_t color;
-	uint32_t ptr;
+rvlDisplay_Return_Codes_e  color16_graphics::drawBitmap16(int16_t x, int16_t y, uint8_t *pBmp, uint16_t w, uint16_t h, bool bigEndianTopDown) {
 	// 1. Check for null pointer
 	if( pBmp == nullptr)
 	{
-		std::cout << "Error drawBitmap24 1: Bitmap array is nullptr" << std::endl;
+		std::cout << "Error drawBitmap16 1: Bitmap array is nullptr" << std::endl;
 		return rvlDisplay_BitmapNullptr;
 	}
-	// Check bounds
-	if ((x >= _width) || (y >= _height))
+	if (bigEndianTopDown)
+		return drawBitmap565(x, y, pBmp, w, h);
+	// Trim to clip rectangle
+	int32_t x0 = x, y0 = y, x1 = x + w - 1, y1 = y + h - 1;
+	if (!clipWindow(x0, y0, x1, y1)) return rvlDisplay_Success;
+	if (_imageCache != nullptr)
+	{
+		const uint8_t* pCached = cachedBitmap(pBmp, w, h, 16);
+		if (pCached != nullptr) return drawBitmap565(x, y, pCached, w, h);
+	}
+	uint16_t srcX = x0 - x, srcY = y0 - y;
+	uint16_t clipW = x1 - x0 + 1, clipH = y1 - y0 + 1;
+	const uint32_t srcRowBytes = (uint32_t)w * 2;
+	const uint32_t rowBytes = clipW * 2;
+
+	setAddrWindow(x0, y0, x1, y1);
+	// Byte swap and send a band of rows at a time through the scratch buffer
+	const uint16_t bandRows = RVL_SCRATCH_BUFFER_SIZE / rowBytes;
+	_scratchColor = -1;
+	for (uint16_t row = 0; row < clipH; row += bandRows)
 	{
-		std::cout << "Error drawBitmap16 2: Out of screen bounds" << std::endl;
-		return rvlDisplay_BitmapScreenBounds;
+		uint16_t rows = std::min<uint16_t>(bandRows, clipH - row);
+		for (uint16_t j = 0; j < rows; j++)
+		{
+			const uint8_t* pSrcRow = pBmp + (uint32_t)(h - 1 - (srcY + row + j)) * srcRowBytes + srcX * 2;
+			ConvertRGB565LEtoBE(pSrcRow, _scratchBuffer + j * rowBytes, clipW);
+		}
+		spiWriteDataBuffer(_scratchBuffer, rows * rowBytes);
 	}
-	if ((x + w - 1) >= _width) w = _width - x;
-	if ((y + h - 1) >= _height) h = _height - y;
+	return rvlDisplay_Success;
+}
+
+/*!
+	@brief Draws a bitmap already in display format, with no copy or conversion
+	@param x X coordinate
+	@param y Y coordinate
+	@param pData pointer to first pixel, big endian RGB565, rows top down
+	@param w width to draw in pixels
+	@param h height to draw in pixels
+	@param stride bytes from the start of one source row to the next,
+		0(default) for w * 2. Use a larger stride with pData pointing into a
+		bigger image to draw a sub-rectangle of it.
+	@return enum rvlDisplay_Return_Codes_e 
+		-# rvlDisplay_Success for success
+		-# rvlDisplay_BitmapNullptr Error
+		-# rvlDisplay_BitmapSize Error, stride less than w * 2
+	@note The bitmap is trimmed to the clip rectangle, x and y may be negative.
+		Data goes straight from pData to SPI, one write if the visible rows are
+		contiguous in memory, otherwise one write per row.
+		For pre-converted assets and frames from other processes.
+*/
+rvlDisplay_Return_Codes_e color16_graphics::drawBitmap565(int16_t x, int16_t y, const uint8_t *pData, uint16_t w, uint16_t h, uint32_t stride)
+{
+	if (pData == nullptr)
+	{
+		std::cout << "Error drawBitmap565 1: Bitmap array is nullptr" << std::endl;
+		return rvlDisplay_BitmapNullptr;
+	}
+	if (stride == 0) stride = (uint32_t)w * 2;
+	if (stride < (uint32_t)w * 2)
+	{
+		std::cout << "Error drawBitmap565 2: stride is less than width * 2" << std::endl;
+		return rvlDisplay_BitmapSize;
+	}
+	// Trim to clip rectangle
+	int32_t x0 = x, y0 = y, x1 = x + w - 1, y1 = y + h - 1;
+	if (!clipWindow(x0, y0, x1, y1)) return rvlDisplay_Success;
+	uint16_t srcX = x0 - x, srcY = y0 - y;
+	uint16_t clipW = x1 - x0 + 1, clipH = y1 - y0 + 1;
+	const uint32_t rowBytes = clipW * 2;
+	const uint8_t* pSrc = pData + srcY * stride + srcX * 2;
+
+	setAddrWindow(x0, y0, x1, y1);
+	if (stride == rowBytes) // visible rows are contiguous, one write
+	{
+		spiWriteDataBuffer(pSrc, clipH * rowBytes);
+	} else {
+		for (uint16_t j = 0; j < clipH; j++)
+			spiWriteDataBuffer(pSrc + j * stride, rowBytes);
+	}
+	return rvlDisplay_Success;
+}
+
+/*!
+	@brief Draws a BMP image file to screen, streamed from the file system
+	@param x X coordinate
+	@param y Y coordinate
+	@param path file system path of a 16, 24 or 32 bit BMP file
+	@return enum rvlDisplay_Return_Codes_e 
+		-# rvlDisplay_Success for success
+		-# rvlDisplay_FileOpen, rvlDisplay_FileFormat, rvlDisplay_FileRead Error
+	@note The header is parsed for size, format and pixel data offset, the
+		image is never held in memory. See bmpReader. With an image cache
+		attached (setImageCache) the file is read and converted once, keyed by
+		path, modification time and size, later draws send the cached copy.
+*/
+rvlDisplay_Return_Codes_e color16_graphics::drawBitmapFile(int16_t x, int16_t y, const char* path)
+{
+	rvlImageCache_Key_t key;
+	struct stat st;
+	if (_imageCache != nullptr && path != nullptr && stat(path, &st) == 0)
+	{
+		key.path = path;
+		key.mtimeSec = st.st_mtim.tv_sec;
+		key.mtimeNsec = st.st_mtim.tv_nsec;
+		key.size = st.st_size;
+		const rvlCachedImage_t* pImage = _imageCache->find(key);
+		if (pImage != nullptr)
+			return drawBitmap565(x, y, pImage->data.data(), pImage->width, pImage->height);
+	}
+	bmpReader bmp;
+	rvlDisplay_Return_Codes_e returnCode = bmp.open(path);
+	if (returnCode != rvlDisplay_Success) return returnCode;
+	uint8_t* pDst = key.path.empty() ? nullptr : _imageCache->insert(key, bmp.width(), bmp.height());
+	if (pDst == nullptr) return drawBitmapFile(x, y, bmp); // no cache or larger than budget
+	returnCode = bmp.readRows(0, bmp.height(), 0, bmp.width(), pDst);
+	if (returnCode != rvlDisplay_Success)
+	{
+		_imageCache->erase(key);
+		return returnCode;
+	}
+	return drawBitmap565(x, y, pDst, bmp.width(), bmp.height());
+}
+
+/*!
+	@brief Draws an open BMP image file to screen
+	@param x X coordinate
+	@param y Y coordinate
+	@param bmp an open bmpReader, can be drawn many times
+	@return enum rvlDisplay_Return_Codes_e 
+		-# rvlDisplay_Success for success
+		-# rvlDisplay_BitmapNullptr Error, no file open
+		-# rvlDisplay_FileRead Error
+	@note The image is trimmed to the clip rectangle, x and y may be negative.
+		Only the visible rows and columns are read, a band at a time straight
+		into the scratch buffer, then sent with one write per band.
+*/
+rvlDisplay_Return_Codes_e color16_graphics::drawBitmapFile(int16_t x, int16_t y, bmpReader& bmp)
+{
+	if (!bmp.isOpen())
+	{
+		std::cout << "Error drawBitmapFile 1: No BMP file open" << std::endl;
+		return rvlDisplay_BitmapNullptr;
+	}
+	// Trim to clip rectangle
+	int32_t x0 = x, y0 = y, x1 = x + bmp.width() - 1, y1 = y + bmp.height() - 1;
+	if (!clipWindow(x0, y0, x1, y1)) return rvlDisplay_Success;
+	uint16_t srcX = x0 - x, srcY = y0 - y;
+	uint16_t clipW = x1 - x0 + 1, clipH = y1 - y0 + 1;
+
+	const uint32_t rowBytes = clipW * 2;
+	const uint16_t bandRows = RVL_SCRATCH_BUFFER_SIZE / rowBytes;
+	_scratchColor = -1;
+	setAddrWindow(x0, y0, x1, y1);
+	for (uint16_t row = 0; row < clipH; row += bandRows)
+	{
+		uint16_t rows = std::min<uint16_t>(bandRows, clipH - row);
+		rvlDisplay_Return_Codes_e returnCode = bmp.readRows(srcY + row, rows, srcX, clipW, _scratchBuffer);
+		if (returnCode != rvlDisplay_Success) return returnCode;
+		spiWriteDataBuffer(_scratchBuffer, rows * rowBytes);
+	}
+	return rvlDisplay_Success;
+}
+
+/*!
+	@brief Draws an image from an asset bundle
+	@param x X coordinate
+	@param y Y coordinate
+	@param asset image from assetBundle find or at
+	@return enum rvlDisplay_Return_Codes_e 
+		-# rvlDisplay_Success for success
+		-# rvlDisplay_BitmapNullptr Error, asset is nullptr (name not found)
+	@note Bundle data is already in display order, it is sent straight from
+		the mapped file with no conversion or copy.
+*/
+rvlDisplay_Return_Codes_e color16_graphics::drawAsset(int16_t x, int16_t y, const rvlAsset_t* asset)
+{
+	if (asset == nullptr)
+	{
+		std::cout << "Error drawAsset 1: Asset is nullptr, check name" << std::endl;
+		return rvlDisplay_BitmapNullptr;
+	}
+	return drawBitmap565(x, y, asset->data, asset->width, asset->height);
+}
+
+/*!
+	@brief Draws an RLE565 image held in memory
+	@param x X coordinate
+	@param y Y coordinate
+	@param pData image data, header and packets, see rle565_RVL.hpp
+	@param len bytes of image data
+	@return enum rvlDisplay_Return_Codes_e 
+		-# rvlDisplay_Success for success
+		-# rvlDisplay_BitmapNullptr, rvlDisplay_FileFormat, rvlDisplay_FileRead Error
+*/
+rvlDisplay_Return_Codes_e color16_graphics::drawRLE565(int16_t x, int16_t y, const uint8_t* pData, size_t len)
+{
+	rle565Decoder rle;
+	rvlDisplay_Return_Codes_e returnCode = rle.open(pData, len);
+	if (returnCode != rvlDisplay_Success) return returnCode;
+	return drawRLE565(x, y, rle);
+}
+
+/*!
+	@brief Draws an RLE565 image file, streamed from the file system
+	@param x X coordinate
+	@param y Y coordinate
+	@param path file system path of the image, made by the rvl_rle tool
+	@return enum rvlDisplay_Return_Codes_e 
+		-# rvlDisplay_Success for success
+		-# rvlDisplay_FileOpen, rvlDisplay_FileFormat, rvlDisplay_FileRead Error
+*/
+rvlDisplay_Return_Codes_e color16_graphics::drawRLE565File(int16_t x, int16_t y, const char* path)
+{
+	rle565Decoder rle;
+	rvlDisplay_Return_Codes_e returnCode = rle.open(path);
+	if (returnCode != rvlDisplay_Success) return returnCode;
+	return drawRLE565(x, y, rle);
+}
+
+/*!
+	@brief Draws an RLE565 image from an open decoder
+	@param x X coordinate
+	@param y Y coordinate
+	@param rle open decoder, rewound first so an image can be drawn many times
+	@return enum rvlDisplay_Return_Codes_e 
+		-# rvlDisplay_Success for success
+		-# rvlDisplay_FileFormat, rvlDisplay_FileRead Error, decode stopped
+	@details One address window for the visible part of the image. Literal
+		pixels are copied into the scratch buffer as they are, runs shorter than
+		RVL_RLE565_REPEAT_MIN are expanded into it, longer runs go to
+		writeColorRepeat and are never expanded beyond one scratch buffer.
+		Unless the image is clipped left or right a run may cover several rows
+		and is still sent as one piece. Decoding stops after the last visible row.
+*/
+rvlDisplay_Return_Codes_e color16_graphics::drawRLE565(int16_t x, int16_t y, rle565Decoder& rle)
+{
+	rvlDisplay_Return_Codes_e returnCode = rle.rewind();
+	if (returnCode != rvlDisplay_Success)
+	{
+		std::cout << "Error drawRLE565 1: decoder not open" << std::endl;
+		return returnCode;
+	}
+	const uint16_t w = rle.width(), h = rle.height();
+	// Trim to clip rectangle
+	int32_t x0 = x, y0 = y, x1 = x + w - 1, y1 = y + h - 1;
+	if (w == 0 || h == 0 || !clipWindow(x0, y0, x1, y1)) return rvlDisplay_Success;
+	const uint16_t visX0 = x0 - x, visX1 = x1 - x;
+	const uint32_t visStart = (uint32_t)(y0 - y) * w, visEnd = (uint32_t)(y1 - y + 1) * w;
+	const bool fullRows = (visX0 == 0 && visX1 == w - 1);
+
+	uint32_t used = 0; // bytes waiting in the scratch buffer
+	auto flush = [&]() {
+		if (used > 0) spiWriteDataBuffer(_scratchBuffer, used);
+		used = 0;
+	};
+	// Send count visible pixels of a segment, starting skip pixels in
+	auto emit = [&](const rvlRLE565_Segment_t& segment, uint32_t skip, uint32_t count) {
+		if (segment.run && count >= RVL_RLE565_REPEAT_MIN)
+		{
+			flush();
+			writeColorRepeat(segment.color, count);
+			return;
+		}
+		const uint8_t* pixels = segment.run ? nullptr : segment.pixels + skip * 2;
+		_scratchColor = -1;
+		while (count > 0)
+		{
+			uint32_t n = std::min<uint32_t>(count, (RVL_SCRATCH_BUFFER_SIZE - used) / 2);
+			if (segment.run)
+			{
+				for (uint32_t i = 0; i < n; i++)
+				{
+					_scratchBuffer[used + i * 2] = segment.color >> 8;
+					_scratchBuffer[used + i * 2 + 1] = segment.color & 0xFF;
+				}
+			} else {
+				memcpy(_scratchBuffer + used, pixels, n * 2);
+				pixels += n * 2;
+			}
+			used += n * 2;
+			count -= n;
+			if (used == RVL_SCRATCH_BUFFER_SIZE) flush();
+		}
+	};
+
+	setAddrWindow(x0, y0, x1, y1);
+	uint32_t pos = 0; // image pixel index of the next segment
+	rvlRLE565_Segment_t segment;
+	while (pos < visEnd && rle.next(segment))
+	{
+		uint32_t segStart = pos, segEnd = pos + segment.count;
+		pos = segEnd;
+		if (segEnd <= visStart) continue;
+		if (fullRows)
+		{
+			uint32_t a = std::max(segStart, visStart), b = std::min(segEnd, visEnd);
+			emit(segment, a - segStart, b - a);
+			continue;
+		}
+		// Clipped left or right, send the visible part of each row covered
+		for (uint32_t p = std::max(segStart, visStart); p < std::min(segEnd, visEnd); )
+		{
+			uint32_t col = p % w;
+			uint32_t rowEnd = p - col + w;
+			uint32_t a = p - col + std::max<uint32_t>(col, visX0);
+			uint32_t b = std::min<uint32_t>(std::min(segEnd, rowEnd), p - col + visX1 + 1);
+			if (a < b) emit(segment, a - segStart, b - a);
+			p = rowEnd;
+		}
+	}
+	flush();
+	return rle.status();
+}
+
+/*!
+	@brief Draws a QOI image held in memory
+	@param x X coordinate
+	@param y Y coordinate
+	@param pData image data, see qoi_RVL.hpp
+	@param len bytes of image data
+	@return enum rvlDisplay_Return_Codes_e 
+		-# rvlDisplay_Success for success
+		-# rvlDisplay_BitmapNullptr, rvlDisplay_FileFormat, rvlDisplay_FileRead Error
+*/
+rvlDisplay_Return_Codes_e color16_graphics::drawQOI(int16_t x, int16_t y, const uint8_t* pData, size_t len)
+{
+	qoiDecoder qoi;
+	rvlDisplay_Return_Codes_e returnCode = qoi.open(pData, len);
+	if (returnCode != rvlDisplay_Success) return returnCode;
+	return drawQOI(x, y, qoi);
+}
+
+/*!
+	@brief Draws a QOI image file, streamed from the file system
+	@param x X coordinate
+	@param y Y coordinate
+	@param path file system path of the image, e.g. made by the rvl_qoi tool
+	@return enum rvlDisplay_Return_Codes_e 
+		-# rvlDisplay_Success for success
+		-# rvlDisplay_FileOpen, rvlDisplay_FileFormat, rvlDisplay_FileRead Error
+*/
+rvlDisplay_Return_Codes_e color16_graphics::drawQOIFile(int16_t x, int16_t y, const char* path)
+{
+	qoiDecoder qoi;
+	rvlDisplay_Return_Codes_e returnCode = qoi.open(path);
+	if (returnCode != rvlDisplay_Success) return returnCode;
+	return drawQOI(x, y, qoi);
+}
+
+/*!
+	@brief Draws a QOI image from an open decoder
+	@param x X coordinate
+	@param y Y coordinate
+	@param qoi open decoder, rewound first so an image can be drawn many times
+	@return enum rvlDisplay_Return_Codes_e 
+		-# rvlDisplay_Success for success
+		-# rvlDisplay_FileFormat, rvlDisplay_FileRead Error, decode stopped
+	@details One address window for the visible part of the image. Bands of
+		rows are decoded straight into the scratch buffer as big endian 565 and
+		sent, no frame buffer is used. QOI can only be decoded in order, rows
+		above the clip rectangle are decoded and thrown away, decoding stops
+		after the last visible row.
+*/
+rvlDisplay_Return_Codes_e color16_graphics::drawQOI(int16_t x, int16_t y, qoiDecoder& qoi)
+{
+	rvlDisplay_Return_Codes_e returnCode = qoi.rewind();
+	if (returnCode != rvlDisplay_Success)
+	{
+		std::cout << "Error drawQOI 1: decoder not open" << std::endl;
+		return returnCode;
+	}
+	const uint16_t w = qoi.width(), h = qoi.height();
+	// Trim to clip rectangle
+	int32_t x0 = x, y0 = y, x1 = x + w - 1, y1 = y + h - 1;
+	if (!clipWindow(x0, y0, x1, y1)) return rvlDisplay_Success;
+	const uint16_t visX = x0 - x, visW = x1 - x0 + 1;
+	const uint16_t visY = y0 - y, visH = y1 - y0 + 1;
+	const uint32_t rowBytes = (uint32_t)visW * 2;
+	const uint16_t bandRows = RVL_SCRATCH_BUFFER_SIZE / rowBytes;
+
+	returnCode = qoi.skipRows(visY);
+	if (returnCode != rvlDisplay_Success) return returnCode;
+	setAddrWindow(x0, y0, x1, y1);
+	_scratchColor = -1;
+	for (uint16_t row = 0; row < visH; row += bandRows)
+	{
+		uint16_t rows = std::min<uint16_t>(bandRows, visH - row);
+		returnCode = qoi.readRows(rows, visX, visW, _scratchBuffer);
+		if (returnCode != rvlDisplay_Success) return returnCode;
+		spiWriteDataBuffer(_scratchBuffer, rows * rowBytes);
+	}
+	return rvlDisplay_Success;
+}
+
+/*!
+	@brief Draws a baseline JPEG image held in memory
+	@param x X coordinate
+	@param y Y coordinate
+	@param pData image data
+	@param len bytes of image data
+	@param scale decode at full size, 1/2, 1/4 or 1/8
+	@return enum rvlDisplay_Return_Codes_e 
+		-# rvlDisplay_Success for success
+		-# rvlDisplay_BitmapNullptr, rvlDisplay_FileFormat, rvlDisplay_FileRead Error
+*/
+rvlDisplay_Return_Codes_e color16_graphics::drawJPEG(int16_t x, int16_t y, const uint8_t* pData, size_t len, jpegDecoder::JPEGScale_e scale)
+{
+	jpegDecoder jpeg;
+	jpeg.setScale(scale);
+	rvlDisplay_Return_Codes_e returnCode = jpeg.open(pData, len);
+	if (returnCode != rvlDisplay_Success) return returnCode;
+	return drawJPEG(x, y, jpeg);
+}
 
-	// Create bitmap buffer
-	uint8_t* buffer = (uint8_t*)malloc(w * h * 2);
-	if (buffer == nullptr) // check malloc
+/*!
+	@brief Draws a baseline JPEG image file, streamed from the file system
+	@param x X coordinate
+	@param y Y coordinate
+	@param path file system path of the image
+	@param scale decode at full size, 1/2, 1/4 or 1/8
+	@return enum rvlDisplay_Return_Codes_e 
+		-# rvlDisplay_Success for success
+		-# rvlDisplay_FileOpen, rvlDisplay_FileFormat, rvlDisplay_FileRead Error
+*/
+rvlDisplay_Return_Codes_e color16_graphics::drawJPEGFile(int16_t x, int16_t y, const char* path, jpegDecoder::JPEGScale_e scale)
+{
+	jpegDecoder jpeg;
+	jpeg.setScale(scale);
+	rvlDisplay_Return_Codes_e returnCode = jpeg.open(path);
+	if (returnCode != rvlDisplay_Success) return returnCode;
+	return drawJPEG(x, y, jpeg);
+}
+
+/*!
+	@brief Draws a JPEG image from an open decoder at the decoder's scale
+	@param x X coordinate
+	@param y Y coordinate
+	@param jpeg open decoder, rewound first so an image can be drawn many times
+	@return enum rvlDisplay_Return_Codes_e 
+		-# rvlDisplay_Success for success
+		-# rvlDisplay_FileFormat, rvlDisplay_FileRead Error, decode stopped
+	@details One address window for the visible part of the image. Each MCU
+		row is decoded into a strip of visible width, in the scratch buffer when
+		it fits, else in a strip buffer kept between draws, and sent as soon as
+		it is complete. MCU rows above the clip
+		rectangle are entropy decoded only, decoding stops after the last
+		visible row.
+*/
+rvlDisplay_Return_Codes_e color16_graphics::drawJPEG(int16_t x, int16_t y, jpegDecoder& jpeg)
+{
+	rvlDisplay_Return_Codes_e returnCode = jpeg.rewind();
+	if (returnCode != rvlDisplay_Success)
+	{
+		std::cout << "Error drawJPEG 1: decoder not open" << std::endl;
+		return returnCode;
+	}
+	const uint16_t w = jpeg.scaledWidth(), h = jpeg.scaledHeight();
+	// Trim to clip rectangle
+	int32_t x0 = x, y0 = y, x1 = x + w - 1, y1 = y + h - 1;
+	if (!clipWindow(x0, y0, x1, y1)) return rvlDisplay_Success;
+	const uint16_t visX = x0 - x, visW = x1 - x0 + 1;
+	const uint16_t visY = y0 - y, visEnd = y1 - y + 1;
+	const uint32_t rowBytes = (uint32_t)visW * 2;
+	const uint32_t stripBytes = rowBytes * jpeg.stripHeight();
+
+	uint8_t* pStrip = _scratchBuffer;
+	if (stripBytes > RVL_SCRATCH_BUFFER_SIZE)
 	{
-		std::cout << "Error drawBitmap16 3 :MALLOC could not assign memory " << std::endl;
-		return rvlDisplay_MallocError;
+		if (_jpegStrip.size() < stripBytes) _jpegStrip.resize(stripBytes);
+		pStrip = _jpegStrip.data();
 	}
-	ptr = 0;
+	_scratchColor = -1;
 
-	for(j = 0; j < h; j++)
+	setAddrWindow(x0, y0, x1, y1);
+	while (jpeg.row() < visEnd)
 	{
-		for(i = 0; i < w; i ++)
+		const uint16_t first = jpeg.row(), rows = jpeg.stripRows();
+		if (first + rows <= visY)
 		{
-			color = *(unsigned int*)(pBmp + i * 2 + (h-1-j) * 2 * w);
-			buffer[ptr++] = color >> 8;
-			buffer[ptr++] = color;
+			returnCode = jpeg.readMCURow(0, 0, nullptr);
+		} else {
+			returnCode = jpeg.readMCURow(visX, visW, pStrip);
+			if (returnCode == rvlDisplay_Success)
+			{
+				const uint16_t a = std::max(first, visY);
+				const uint16_t b = std::min<uint16_t>(first + rows, visEnd);
+				spiWriteDataBuffer(pStrip + (a - first) * rowBytes, (b - a) * rowBytes);
+			}
 		}
+		if (returnCode != rvlDisplay_Success) break;
 	}
+	return returnCode;
+}
 
-	// Set window and write buffer
-	setAddrWindow(x, y, x + w - 1, y + h - 1);
-	spiWriteDataBuffer(buffer, h*w*sizeof(uint16_t));
+/*!
+	@brief Draws one frame of a delta frame animation, its changed rectangles only
+	@param x X coordinate of the animation
+	@param y Y coordinate of the animation
+	@param anim open animation
+	@param frame 0 to frameCount()-1, or frameCount() for the loop frame
+	@return enum rvlDisplay_Return_Codes_e 
+		-# rvlDisplay_Success for success
+		-# rvlDisplay_BitmapNullptr animation not open or frame out of range
+		-# rvlDisplay_FileFormat, rvlDisplay_FileRead Error, bad RLE565 data
+	@note Frame 0 draws the whole image, any other frame must follow the one
+		before it. Raw rectangles go through drawBitmap565, RLE565 rectangles
+		through drawRLE565, one address window per rectangle.
+*/
+rvlDisplay_Return_Codes_e color16_graphics::drawAnimationFrame(int16_t x, int16_t y, const deltaAnimation& anim, uint16_t frame)
+{
+	const rvlAnimFrame_t* pFrame = anim.frame(frame);
+	if (pFrame == nullptr)
+	{
+		std::cout << "Error drawAnimationFrame 1: animation not open or no frame " << frame << std::endl;
+		return rvlDisplay_BitmapNullptr;
+	}
+	for (uint32_t i = 0; i < pFrame->rectCount; i++)
+	{
+		const rvlAnimRect_t* pRect = anim.rect(pFrame->firstRect + i);
+		rvlDisplay_Return_Codes_e returnCode;
+		if (pRect->encoding == RVL_ANIM_RLE565)
+			returnCode = drawRLE565(x + pRect->x, y + pRect->y, pRect->data, pRect->length);
+		else
+			returnCode = drawBitmap565(x + pRect->x, y + pRect->y, pRect->data, pRect->w, pRect->h);
+		if (returnCode != rvlDisplay_Success) return returnCode;
+	}
+	return rvlDisplay_Success;
+}
 
-	free(buffer);
+/*!
+	@brief Plays a delta frame animation, each frame shown for its own delay
+	@param x X coordinate of the animation
+	@param y Y coordinate of the animation
+	@param anim open animation
+	@param loops number of times to play the animation
+	@return enum rvlDisplay_Return_Codes_e, see drawAnimationFrame
+	@note The first loop starts with the whole image, frame 0, later loops with
+		the loop frame, so only changed pixels are sent once it is running.
+		Delays are measured from the start of each frame, a frame that takes
+		longer to draw than its delay is followed straight away by the next.
+		Bytes sent per loop are given by deltaAnimation::loopBusBytes.
+*/
+rvlDisplay_Return_Codes_e color16_graphics::playAnimation(int16_t x, int16_t y, const deltaAnimation& anim, uint16_t loops)
+{
+	if (!anim.isOpen())
+	{
+		std::cout << "Error playAnimation 1: animation not open" << std::endl;
+		return rvlDisplay_BitmapNullptr;
+	}
+	auto due = std::chrono::steady_clock::now();
+	for (uint16_t loop = 0; loop < loops; loop++)
+	{
+		for (uint16_t i = 0; i < anim.frameCount(); i++)
+		{
+			const uint16_t frame = (i == 0 && loop > 0 && anim.hasLoopFrame()) ? anim.frameCount() : i;
+			rvlDisplay_Return_Codes_e returnCode = drawAnimationFrame(x, y, anim, frame);
+			if (returnCode != rvlDisplay_Success) return returnCode;
+			due += std::chrono::milliseconds(anim.frame(frame)->delayMs);
+			auto now = std::chrono::steady_clock::now();
+			if (due > now) std::this_thread::sleep_until(due);
+			else due = now;
+		}
+	}
 	return rvlDisplay_Success;
 }
 
+/*!
+	@brief Attach a cache of converted images used by drawBitmap24, drawBitmap16
+		and drawBitmapFile(path)
+	@param cache the cache, owned by the caller, nullptr to detach
+	@note One cache may be shared by several displays.
+*/
+void color16_graphics::setImageCache(imageCache* cache)
+{
+	_imageCache = cache;
+}
+
+/*!
+	@brief Find a bitmap in the image cache, converting and adding it on a miss
+	@param pBmp source data, as passed to drawBitmap24 / drawBitmap16
+	@param w width of the bitmap in pixels
+	@param h height of the bitmap in pixels
+	@param bitsPerPixel 24 for BGR888, 16 for little endian 565, rows bottom up
+	@return big endian RGB565 rows top down, or nullptr if larger than the budget
+*/
+const uint8_t* color16_graphics::cachedBitmap(const uint8_t* pBmp, uint16_t w, uint16_t h, uint8_t bitsPerPixel)
+{
+	rvlImageCache_Key_t key;
+	key.source = pBmp;
+	key.width = w;
+	key.height = h;
+	key.format = bitsPerPixel;
+	const rvlCachedImage_t* pImage = _imageCache->find(key);
+	if (pImage != nullptr) return pImage->data.data();
+
+	uint8_t* pDst = _imageCache->insert(key, w, h);
+	if (pDst == nullptr) return nullptr;
+	const uint32_t srcRowBytes = (uint32_t)w * (bitsPerPixel / 8);
+	for (uint16_t row = 0; row < h; row++)
+	{
+		const uint8_t* pSrcRow = pBmp + (uint32_t)(h - 1 - row) * srcRowBytes;
+		if (bitsPerPixel == 24)
+			ConvertBGR888toRGB565BE(pSrcRow, pDst + (uint32_t)row * w * 2, w);
+		else
+			ConvertRGB565LEtoBE(pSrcRow, pDst + (uint32_t)row * w * 2, w);
+	}
+	return pDst;
+}
+
 /*!
 	@brief: Convert: 24-bit color to 565 16-bit color
 	@param r color red
@@ -695,6 +1281,71 @@ int16_t color16_graphics::Color565(int16_t r, int16_t g, int16_t b) {
 	return ((r & 0xF8) << 8) | ((g & 0xFC) << 3) | (b >> 3);
 }
 
+/*!
+	@brief Fill a list of horizontal spans with one color
+	@param spans array of spans, ordered top to bottom
+	@param count number of spans in array
+	@param color 565 16-bit
+	@details Spans on consecutive rows with the same start and width are
+		merged into one rectangle, so each run of identical spans costs
+		one address window. Pixels come from the pre-filled scratch buffer.
+*/
+void color16_graphics::fillSpans(const rvlDisplay_Span_t* spans, size_t count, uint16_t color) {
+	size_t i = 0;
+	while (i < count) {
+		size_t j = i + 1;
+		while (j < count && spans[j].x == spans[i].x && spans[j].w == spans[i].w &&
+				spans[j].y == spans[j - 1].y + 1) {
+			j++;
+		}
+		fillRectWindow(spans[i].x, spans[i].y, spans[i].w, (int16_t)(j - i), color);
+		i = j;
+	}
+}
+
+/*!
+	@brief Fill a rectangle with one address window, trimmed to the clip rectangle
+	@param x x start coordinate
+	@param y y start coordinate
+	@param w width of the rectangle
+	@param h height of the rectangle
+	@param color 565 16-bit
+	@return false if nothing was drawn, the rectangle lies outside the clip rectangle
+*/
+bool color16_graphics::fillRectWindow(int16_t x, int16_t y, int32_t w, int32_t h, uint16_t color) {
+	int32_t x0 = x, y0 = y, x1 = x + w - 1, y1 = y + h - 1;
+	if (!clipWindow(x0, y0, x1, y1)) return false;
+	setAddrWindow(x0, y0, x1, y1);
+	writeColorRepeat(color, (uint32_t)(x1 - x0 + 1) * (uint32_t)(y1 - y0 + 1));
+	return true;
+}
+
+/*!
+	@brief Stream one color to the display count times
+	@param color 565 16-bit
+	@param count number of pixels
+	@note An address window must already be set. The scratch buffer is filled
+		with the color once and then sent in chunks, so no per pixel SPI calls.
+*/
+void color16_graphics::writeColorRepeat(uint16_t color, uint32_t count) {
+	const uint32_t chunkPixels = RVL_SCRATCH_BUFFER_SIZE / 2;
+	uint32_t needPixels = (count < chunkPixels) ? count : chunkPixels;
+	if (_scratchColor != color) {
+		_scratchColor = color;
+		_scratchFilled = 0;
+	}
+	for (uint32_t i = _scratchFilled; i < needPixels; i++) {
+		_scratchBuffer[2 * i] = color >> 8;
+		_scratchBuffer[2 * i + 1] = color & 0xFF;
+	}
+	if (needPixels > _scratchFilled) _scratchFilled = needPixels;
+	while (count > 0) {
+		uint32_t chunk = (count < chunkPixels) ? count : chunkPixels;
+		spiWriteDataBuffer(_scratchBuffer, chunk * 2);
+		count -= chunk;
+	}
+}
+
 /*!
  * @brief pushColor
  * @param color
@@ -737,7 +1388,7 @@ void color16_graphics::writeData(uint8_t spidatabyte) {
 	@param spidata to send
 	@param len length of buffer
 */
-void color16_graphics::spiWriteDataBuffer(uint8_t* spidata, uint32_t len) {
+void color16_graphics::spiWriteDataBuffer(const uint8_t* spidata, uint32_t len) {
 	DisplayRVL_DC_SetHigh;
 	if (_hardwareSPI == false) {
 		DisplayRVL_CS_SetLow;
@@ -746,10 +1397,10 @@ void color16_graphics::spiWriteDataBuffer(uint8_t* spidata, uint32_t len) {
 	} else {
 		if (_TFT_SPI_Handle_Chosen == 0)
 		{
-			bcm2835_spi_writenb((char*)spidata,len);
+			bcm2835_spi_writenb((const char*)spidata,len);
 		} else if (_TFT_SPI_Handle_Chosen == 1)
 		{
-			bcm2835_aux_spi_writenb((char*)spidata,len);
+			bcm2835_aux_spi_writenb((const char*)spidata,len);
 		}
 	}
 }
@@ -804,6 +1455,104 @@ void color16_graphics::setCursor(int16_t x, int16_t y) {
 	_cursorY = y;
 }
 
+/*!
+	@brief Get the x co-ord of the cursor position
+	@return cursor x, where print draws next
+*/
+int16_t color16_graphics::getCursorX(void) {
+	return _cursorX;
+}
+
+/*!
+	@brief Get the y co-ord of the cursor position
+	@return cursor y, where print draws next
+*/
+int16_t color16_graphics::getCursorY(void) {
+	return _cursorY;
+}
+
+/*!
+	@brief Push a clip rectangle on to the clip stack
+	@param x x start coordinate, may be negative
+	@param y y start coordinate, may be negative
+	@param w width of the clip rectangle
+	@param h height of the clip rectangle
+	@return enum rvlDisplay_Return_Codes_e
+		-# rvlDisplay_Success for success
+		-# rvlDisplay_ClipStack Error, stack is full
+	@note The new clip is the intersection with the current clip, so nested
+		panels can never draw outside their parent. All primitives are
+		trimmed to the clip before any bytes are sent to the display.
+*/
+rvlDisplay_Return_Codes_e color16_graphics::pushClipRect(int16_t x, int16_t y, uint16_t w, uint16_t h) {
+	if (_clipDepth >= RVL_CLIP_STACK_DEPTH)
+	{
+		std::cout << "Error pushClipRect 1: Clip stack is full" << std::endl;
+		return rvlDisplay_ClipStack;
+	}
+	int32_t x0 = x, y0 = y, x1 = x + w - 1, y1 = y + h - 1;
+	if (_clipDepth > 0)
+	{
+		const rvlDisplay_Clip_t& top = _clipStack[_clipDepth - 1];
+		x0 = std::max<int32_t>(x0, top.x0);
+		y0 = std::max<int32_t>(y0, top.y0);
+		x1 = std::min<int32_t>(x1, top.x1);
+		y1 = std::min<int32_t>(y1, top.y1);
+	}
+	x1 = std::min<int32_t>(x1, INT16_MAX);
+	y1 = std::min<int32_t>(y1, INT16_MAX);
+	_clipStack[_clipDepth++] = {(int16_t)x0, (int16_t)y0, (int16_t)x1, (int16_t)y1};
+	return rvlDisplay_Success;
+}
+
+/*!
+	@brief Pop the top clip rectangle off the clip stack, restoring the previous clip
+	@return enum rvlDisplay_Return_Codes_e
+		-# rvlDisplay_Success for success
+		-# rvlDisplay_ClipStack Error, stack is empty
+*/
+rvlDisplay_Return_Codes_e color16_graphics::popClipRect(void) {
+	if (_clipDepth == 0)
+	{
+		std::cout << "Error popClipRect 1: Clip stack is empty" << std::endl;
+		return rvlDisplay_ClipStack;
+	}
+	_clipDepth--;
+	return rvlDisplay_Success;
+}
+
+/*!
+	@brief Empty the clip stack, drawing is clipped to the screen only
+*/
+void color16_graphics::resetClipRect(void) {
+	_clipDepth = 0;
+}
+
+/*!
+	@brief Trim a window to the active clip rectangle and the screen
+	@param x0 left column, updated
+	@param y0 top row, updated
+	@param x1 right column, updated
+	@param y1 bottom row, updated
+	@return true if any of the window is visible
+*/
+bool color16_graphics::clipWindow(int32_t& x0, int32_t& y0, int32_t& x1, int32_t& y1) {
+	int32_t clipX0 = 0, clipY0 = 0, clipX1 = _width - 1, clipY1 = _height - 1;
+	if (_clipDepth > 0)
+	{
+		const rvlDisplay_Clip_t& top = _clipStack[_clipDepth - 1];
+		if (top.x0 > clipX0) clipX0 = top.x0;
+		if (top.y0 > clipY0) clipY0 = top.y0;
+		if (top.x1 < clipX1) clipX1 = top.x1;
+		if (top.y1 < clipY1) clipY1 = top.y1;
+	}
+	if (x0 < clipX0) x0 = clipX0;
+	if (y0 < clipY0) y0 = clipY0;
+	if (x1 > clipX1) x1 = clipX1;
+	if (y1 > clipY1) y1 = clipY1;
+	return (x0 <= x1) && (y0 <= y1);
+}
+
 /*!
 	@brief Write 1 character on OLED.
 	@param  x character starting position on x-axis. Valid values: 0..127
@@ -813,15 +1562,18 @@ void color16_graphics::setCursor(int16_t x, int16_t y) {
 		-# rvlDisplay_Success  success
 		-# rvlDisplay_CharScreenBounds co-ords out of bounds check x and y
 		-# rvlDisplay_CharFontASCIIRange Character out of ASCII Font bounds, check Font range
+	@note The glyph is sent by writeTextRun in one address window, trimmed to
+		the clip rectangle. With a glyph cache attached (setGlyphCache) the
+		cached glyph is sent with no rendering. In transparent mode
+		(setTextTransparent) only the glyph pixels are sent, as horizontal
+		runs, see glyphSpans. A proportional font character takes a cell of
+		its own advance. Characters are drawn at the text scale, see setTextScale.
  */
 rvlDisplay_Return_Codes_e color16_graphics::writeChar(int16_t x, int16_t y, char value) {
 
 
 	// 1. Check for screen out of  bounds
-	if((x >= _width)            || // Clip right
-	(y >= _height)           || // Clip bottom
-	((x + _Font_X_Size+1) < 0) || // Clip left
-	((y + _Font_Y_Size) < 0))   // Clip top
+	if(!charInBounds(x, y))
 	{
 		std::cout << "writeChar Error 1: Co-ordinates out of bounds" << std::endl;
 		return rvlDisplay_CharScreenBounds;
@@ -832,68 +1584,285 @@ rvlDisplay_Return_Codes_e color16_graphics::writeChar(int16_t x, int16_t y, char
 		std::cout << "writeChar Error 2: Character out of Font bounds" << value << " :" << +_FontOffset << " <--> " << +(_FontOffset + _FontNumChars)<< std::endl;
 		return rvlDisplay_CharFontASCIIRange;
 	}
+	// Character entirely outside clip rectangle, nothing to send
+	int32_t bx0 = x, by0 = y, bx1 = x + textCellWidth() - 1, by1 = y + textCellHeight() - 1;
+	if (!clipWindow(bx0, by0, bx1, by1)) return rvlDisplay_Success;
+	// 3. Send the glyph as a run of one character
+	const uint8_t character = value;
+	return writeTextRun(x, y, &character, 1);
+}
 
-	uint16_t ltextcolor = 0; 
-	uint16_t ltextbgcolor = 0; 
-	if (getInvertFont()== true)
-	{
-		ltextbgcolor = _textcolor;
-		ltextcolor = _textbgcolor;
-	}else
+/*!
+	@brief Check a character position is on screen, as writeChar requires
+	@param x character starting position on x-axis
+	@param y character starting position on y-axis
+	@return true if writeChar accepts the position
+ */
+bool color16_graphics::charInBounds(int16_t x, int16_t y)
+{
+	return !((x >= _width)            || // Clip right
+		(y >= _height)           || // Clip bottom
+		((x + textCellWidth() + 1) < 0) || // Clip left
+		((y + textCellHeight()) < 0));   // Clip top
+}
+
+/*!
+	@brief Count the leading characters of a text which can go in one run
+	@param pText text, not null terminated
+	@param len number of characters at pText
+	@return number of leading characters in the current font's range,
+		stops at the first new line or carriage return
+ */
+uint16_t color16_graphics::textRunLength(const uint8_t* pText, size_t len)
+{
+	uint16_t count = 0;
+	while (count < len && count < UINT16_MAX)
 	{
-		ltextbgcolor = _textbgcolor;
-		ltextcolor = _textcolor;
+		const char value = (char)pText[count]; // same range check as writeChar
+		if (value == '\n' || value == '\r') break;
+		if (value < _FontOffset || value >= (_FontOffset + _FontNumChars + 1)) break;
+		count++;
 	}
-	uint16_t fontIndex = 0;
+	return count;
+}
 
-	if (_Font_Y_Size % 8 == 0) // Is the font height divisible by 8
+/*!
+	@brief Write a run of characters on one line in one address window
+	@param x starting position of the first character on x-axis
+	@param y starting position on y-axis
+	@param pText characters, all in the font's range, see textRunLength
+	@param count number of characters
+	@return Will return rvlDisplay_Return_Codes_e enum
+		-# rvlDisplay_Success  success
+		-# rvlDisplay_CharScreenBounds co-ords out of bounds check x and y
+	@note The run is rendered side by side into a strip buffer, kept between
+		calls, and sent with drawBitmap565 trimmed to the clip rectangle.
+		Each character takes a cell of its own advance, the font width for
+		fixed fonts. Used by writeChar, writeCharString and print so a whole
+		label is one transaction. Glyphs in the glyph cache, if attached, are
+		copied in with no rendering. In transparent mode the glyph pixels of
+		the whole run are sent as one span list, see glyphSpans. With a text
+		scale above 1 each glyph is rendered at font size and its pixels
+		replicated into the strip, see scaleGlyph.
+ */
+rvlDisplay_Return_Codes_e color16_graphics::writeTextRun(int16_t x, int16_t y, const uint8_t* pText, uint16_t count)
+{
+	if (!charInBounds(x, y))
+	{
+		std::cout << "writeTextRun Error 1: Co-ordinates out of bounds" << std::endl;
+		return rvlDisplay_CharScreenBounds;
+	}
+	uint32_t runW = 0;
+	for (uint16_t i = 0; i < count; i++) runW += textAdvance(pText[i]);
+	const uint16_t runH = textCellHeight();
+	// Run entirely outside clip rectangle, nothing to send
+	int32_t x0 = x, y0 = y, x1 = x + (int32_t)runW - 1, y1 = y + runH - 1;
+	if (count == 0 || !clipWindow(x0, y0, x1, y1)) return rvlDisplay_Success;
+
+	const bool inverted = getInvertFont();
+	const uint16_t ltextcolor = inverted ? _textbgcolor : _textcolor;
+	const uint16_t ltextbgcolor = inverted ? _textcolor : _textbgcolor;
+	const uint32_t stride = runW * 2;
+	if (_textTransparent)
+		_spanList.clear();
+	else if (_textStrip.size() < stride * runH)
+		_textStrip.resize(stride * runH);
+	int32_t cellRight = x;
+	for (uint16_t i = 0; i < count; i++)
 	{
-		uint16_t rowCount = 0;
-		uint16_t temp = 0;
-		uint16_t count;
-		uint16_t colIndex;
-		fontIndex = ((value - _FontOffset)*(_Font_X_Size * (_Font_Y_Size/ 8))) + 4;
-		for (rowCount = 0; rowCount < (_Font_Y_Size / 8); rowCount++)
+		const uint8_t advance = glyphAdvance(pText[i]);
+		const int32_t cellLeft = cellRight;
+		cellRight += advance * _textScale;
+		// Only glyphs at least partly inside the clip are rendered
+		if (cellRight <= x0 || cellLeft > x1) continue;
+		if (_textTransparent)
 		{
-			for (count = 0; count < _Font_X_Size; count++)
+			glyphSpans(pText[i], cellLeft, y);
+			continue;
+		}
+		uint8_t* pDst = _textStrip.data() + (cellLeft - x) * 2;
+		const uint8_t* pGlyph = cachedGlyph(pText[i], ltextcolor, ltextbgcolor);
+		if (pGlyph == nullptr)
+		{
+			if (_textScale == 1)
 			{
-				temp = *(_FontSelect + fontIndex + count + (rowCount * _Font_X_Size));
-				for (colIndex = 0; colIndex < 8; colIndex++)
-				{
-					if (temp & (1 << colIndex)) {
-							drawPixel(x + count, y + (rowCount * 8) + colIndex, ltextcolor);
-					} else {
-							drawPixel(x + count, y + (rowCount * 8) + colIndex, ltextbgcolor);
-					}
-				}
+				renderGlyph(pText[i], pDst, stride, ltextcolor, ltextbgcolor);
+				continue;
 			}
+			// Render at font size, then replicate
+			const size_t glyphBytes = (size_t)advance * _Font_Y_Size * 2;
+			if (_glyphBuffer.size() < glyphBytes) _glyphBuffer.resize(glyphBytes);
+			renderGlyph(pText[i], _glyphBuffer.data(), advance * 2, ltextcolor, ltextbgcolor);
+			pGlyph = _glyphBuffer.data();
 		}
-	} else
+		scaleGlyph(pGlyph, advance, pDst, stride);
+	}
+	if (_textTransparent)
+	{
+		fillSpans(_spanList.data(), _spanList.size(), ltextcolor);
+		return rvlDisplay_Success;
+	}
+	return drawBitmap565(x, y, _textStrip.data(), runW, runH, stride);
+}
+
+/*!
+	@brief Copy a glyph rendered at font size into the text strip at the text scale
+	@param pSrc big endian RGB565 rows top down, advance * 2 bytes a row
+	@param advance glyph width in pixels, before scaling
+	@param pDst destination of the top left pixel
+	@param stride bytes from one row of pDst to the next
+	@details Each pixel is repeated _textScale times across, each row
+		_textScale times down, as a copy of the first.
+ */
+void color16_graphics::scaleGlyph(const uint8_t* pSrc, uint8_t advance, uint8_t* pDst, uint32_t stride)
+{
+	const uint32_t srcRowBytes = advance * 2;
+	const uint32_t dstRowBytes = srcRowBytes * _textScale;
+	for (uint16_t row = 0; row < _Font_Y_Size; row++, pSrc += srcRowBytes)
 	{
-		int16_t colByte, cx, cy;
-		int16_t colbit;
-		fontIndex = ((value - _FontOffset)*((_Font_X_Size * _Font_Y_Size) / 8)) + 4;
-		colByte = *(_FontSelect + fontIndex);
-		colbit = 7;
-		for (cx = 0; cx < _Font_X_Size; cx++)
+		uint8_t* pRow = pDst + row * _textScale * stride;
+		if (_textScale == 1)
+		{
+			memcpy(pRow, pSrc, srcRowBytes);
+			continue;
+		}
+		uint8_t* p = pRow;
+		for (uint16_t cx = 0; cx < advance; cx++)
 		{
-			for (cy = 0; cy < _Font_Y_Size; cy++)
+			for (uint8_t k = 0; k < _textScale; k++, p += 2)
 			{
-				if ((colByte & (1 << colbit)) != 0) {
-					drawPixel(x + cx, y + cy, ltextcolor);
-				} else {
-					drawPixel(x + cx, y + cy, ltextbgcolor);
-				}
-				colbit--;
-				if (colbit < 0) {
-					colbit = 7;
-					fontIndex++;
-					colByte = *(_FontSelect + fontIndex);
-				}
+				p[0] = pSrc[cx * 2];
+				p[1] = pSrc[cx * 2 + 1];
 			}
 		}
+		for (uint8_t k = 1; k < _textScale; k++)
+			memcpy(pRow + k * stride, pRow, dstRowBytes);
+	}
+}
+
+/*!
+	@brief Find a glyph of the current font and text colors in the glyph cache,
+		rendering and adding it on a miss
+	@param value character, must be in the font's range
+	@param color foreground color, after inversion
+	@param bgcolor background color, after inversion
+	@return big endian RGB565 rows top down, glyphAdvance(value) * 2 bytes a row,
+		or nullptr if no cache is attached or the glyph is larger than the budget
+ */
+const uint8_t* color16_graphics::cachedGlyph(char value, uint16_t color, uint16_t bgcolor)
+{
+	if (_glyphCache == nullptr) return nullptr;
+	rvlGlyphCache_Key_t key;
+	key.font = (_FontProp != nullptr) ? (const void*)_FontProp : (const void*)_FontSelect;
+	key.character = (uint8_t)value;
+	key.inverted = getInvertFont();
+	key.color = _textcolor;
+	key.bgcolor = _textbgcolor;
+	const uint8_t* pGlyph = _glyphCache->find(key);
+	if (pGlyph != nullptr) return pGlyph;
+
+	const uint8_t advance = glyphAdvance(value);
+	uint8_t* pDst = _glyphCache->insert(key, (size_t)advance * _Font_Y_Size * 2);
+	if (pDst == nullptr) return nullptr;
+	renderGlyph(value, pDst, advance * 2, color, bgcolor);
+	return pDst;
+}
+
+/*!
+	@brief Add the set pixels of one character to the span list as horizontal runs
+	@param value character, must be in the font's range
+	@param x character starting position on x-axis
+	@param y character starting position on y-axis
+	@details Runs are appended to _spanList ordered by column, start and width,
+		then row, so fillSpans merges runs stacked on consecutive rows, such as
+		vertical strokes, into one window. At a text scale above 1 each run is
+		scaled across and repeated down, the repeats merge the same way.
+ */
+void color16_graphics::glyphSpans(char value, int16_t x, int16_t y)
+{
+	const rvlPropGlyph_t* pProp = (_FontProp != nullptr) ? &_FontProp->glyphs[(uint8_t)value - _FontOffset] : nullptr;
+	const bool banded = (_Font_Y_Size % 8 == 0);
+	const uint8_t* pGlyph;
+	if (pProp != nullptr)
+		pGlyph = _FontProp->bitmap + pProp->offset;
+	else
+		pGlyph = _FontSelect + 4 + (value - _FontOffset) * _FontGlyphBytes;
+	auto isSet = [&](uint16_t cx, uint16_t cy) -> bool {
+		if (pProp != nullptr)
+		{
+			const int32_t bx = cx - pProp->xOffset, by = cy - pProp->yOffset;
+			if (bx < 0 || by < 0 || bx >= pProp->width || by >= pProp->height) return false;
+			const uint32_t bit = by * pProp->width + bx;
+			return pGlyph[bit >> 3] & (0x80 >> (bit & 7));
+		}
+		if (banded) return pGlyph[(cy / 8) * _Font_X_Size + cx] & (1 << (cy % 8));
+		const uint32_t bit = cx * _Font_Y_Size + cy;
+		return pGlyph[bit >> 3] & (0x80 >> (bit & 7));
+	};
+	const uint8_t cellW = glyphAdvance(value);
+	const size_t firstSpan = _spanList.size();
+	for (uint16_t cy = 0; cy < _Font_Y_Size; cy++)
+	{
+		uint16_t cx = 0;
+		while (cx < cellW)
+		{
+			if (!isSet(cx, cy)) { cx++; continue; }
+			const uint16_t start = cx;
+			while (cx < cellW && isSet(cx, cy)) cx++;
+			for (uint8_t k = 0; k < _textScale; k++)
+				_spanList.push_back({(int16_t)(x + start * _textScale), (int16_t)(y + cy * _textScale + k),
+					(int16_t)((cx - start) * _textScale)});
+		}
+	}
+	std::stable_sort(_spanList.begin() + firstSpan, _spanList.end(),
+		[](const rvlDisplay_Span_t& a, const rvlDisplay_Span_t& b) {
+			return (a.x != b.x) ? a.x < b.x : a.w < b.w;
+		});
+}
+
+/*!
+	@brief Render one character of the current font as big endian RGB565 pixels
+	@param value character, must be in the font's range
+	@param pDst destination of the top left pixel
+	@param stride bytes from one row of pDst to the next, at least glyphAdvance(value) * 2
+	@param color foreground color
+	@param bgcolor background color
+	@details Fixed fonts are expanded by the renderer setFont picked for the
+		font's size and layout, see rvlFontLayout_e. Proportional fonts store the
+		bounding box row by row, most significant bit first, the rest of the cell
+		is background.
+ */
+void color16_graphics::renderGlyph(char value, uint8_t* pDst, uint32_t stride, uint16_t color, uint16_t bgcolor)
+{
+	if (_FontProp == nullptr)
+	{
+		_FontRenderer(_FontSelect + 4 + (value - _FontOffset) * _FontGlyphBytes, pDst, stride,
+			color, bgcolor, _Font_X_Size, _Font_Y_Size);
+		return;
+	}
+	const uint8_t fg[2] = {(uint8_t)(color >> 8), (uint8_t)color};
+	const uint8_t bg[2] = {(uint8_t)(bgcolor >> 8), (uint8_t)bgcolor};
+	auto put = [&](uint16_t cx, uint16_t cy, bool set) {
+		uint8_t* p = pDst + cy * stride + cx * 2;
+		const uint8_t* c = set ? fg : bg;
+		p[0] = c[0];
+		p[1] = c[1];
+	};
+	const rvlPropGlyph_t& glyph = _FontProp->glyphs[(uint8_t)value - _FontOffset];
+	for (uint16_t cy = 0; cy < _Font_Y_Size; cy++)
+		for (uint16_t cx = 0; cx < glyph.advance; cx++)
+			put(cx, cy, false);
+	const uint8_t* pGlyph = _FontProp->bitmap + glyph.offset;
+	uint32_t bit = 0;
+	for (uint16_t by = 0; by < glyph.height; by++)
+	{
+		for (uint16_t bx = 0; bx < glyph.width; bx++, bit++)
+		{
+			const int32_t cx = glyph.xOffset + bx, cy = glyph.yOffset + by;
+			if (cx < 0 || cy < 0 || cx >= glyph.advance || cy >= _Font_Y_Size) continue;
+			if (pGlyph[bit >> 3] & (0x80 >> (bit & 7))) put(cx, cy, true);
+		}
 	}
-	return rvlDisplay_Success ;
 }
 
 /*!
@@ -907,29 +1876,41 @@ rvlDisplay_Return_Codes_e color16_graphics::writeChar(int16_t x, int16_t y, char
 		-# Failure in writeChar method upstream
  */
 rvlDisplay_Return_Codes_e  color16_graphics::writeCharString(int16_t x, int16_t y, char * pText) {
-	uint8_t count=0;
-	uint8_t MaxLength=0;
 	// Check for null pointer
 	if(pText == nullptr)
 	{
 		std::cout << "writeCharString Error 1 :String array is not valid pointer" << std::endl;
 		return rvlDisplay_CharArrayNullptr;
 	}
+	const uint8_t* pChars = (const uint8_t*)pText;
+	const size_t length = strnlen(pText, 200); // 2nd way out of loop, safety check
+	size_t index = 0;
 	rvlDisplay_Return_Codes_e DrawCharReturnCode;
-	while(*pText != '\0')
+	while(index < length)
 	{
 		// check if text has reached end of screen
-		if ((x + (count * _Font_X_Size)) > _width - _Font_X_Size)
+		if (x > _width - textCellWidth())
 		{
-			y = y + _Font_Y_Size;
+			y = y + textCellHeight();
 			x = 0;
-			count = 0;
 		}
-		DrawCharReturnCode = writeChar(x + (count * (_Font_X_Size)), y, *pText++);
+		// Characters up to the end of this line go in one run
+		const uint16_t inFont = textRunLength(pChars + index, length - index);
+		uint16_t count = 0;
+		int32_t nextX = x;
+		while (count < inFont && nextX <= _width - textCellWidth())
+			nextX += textAdvance(pText[index + count++]);
+		if (count > 0 && charInBounds(x, y))
+		{
+			DrawCharReturnCode = writeTextRun(x, y, pChars + index, count);
+		} else {
+			count = 1; // reports the error for this character
+			DrawCharReturnCode = writeChar(x, y, pText[index]);
+			nextX = x + textCellWidth();
+		}
 		if(DrawCharReturnCode  != rvlDisplay_Success) return DrawCharReturnCode;
-		count++;
-		MaxLength++;
-		if (MaxLength >= 200) break; // 2nd way out of loop, safety check
+		x = nextX;
+		index += count;
 	}
 	return rvlDisplay_Success;
 }
@@ -947,17 +1928,17 @@ size_t color16_graphics::write(uint8_t character)
 	switch (character)
 	{
 		case '\n':
-			_cursorY += _Font_Y_Size;
+			_cursorY += textCellHeight();
 			_cursorX  = 0;
 		break;
 		case '\r': break;
 		default:
 			DrawCharReturnCode = writeChar(_cursorX, _cursorY, character);
 			if(DrawCharReturnCode  != rvlDisplay_Success) return DrawCharReturnCode;
-			_cursorX += (_Font_X_Size);
-			if (_textwrap && (_cursorX  > (_width - (_Font_X_Size))))
+			_cursorX += textAdvance(character);
+			if (_textwrap && (_cursorX  > (_width - textCellWidth())))
 			{
-				_cursorY += _Font_Y_Size;
+				_cursorY += textCellHeight();
 				_cursorX = 0;
 			}
 		break;
@@ -966,6 +1947,49 @@ size_t color16_graphics::write(uint8_t character)
 return 1;
 }
 
+/*!
+	@brief write method used in the print class for strings and numbers
+	@param buffer the characters to print
+	@param size number of characters
+	@return number of characters processed
+	@details Characters up to a new line, or the wrap point, are sent as one
+		run by writeTextRun, so print(int), print(double) and println each
+		cost one transaction per line. Control characters, characters outside
+		the font and off screen positions go through write(uint8_t).
+*/
+size_t color16_graphics::write(const uint8_t *buffer, size_t size)
+{
+	if (buffer == nullptr) return 0;
+	size_t n = 0;
+	while (n < size)
+	{
+		const uint16_t inFont = textRunLength(buffer + n, size - n);
+		// limit the run to the wrap point, or the right edge of the screen
+		uint16_t count = 0;
+		int32_t nextX = _cursorX;
+		while (count < inFont)
+		{
+			if (!_textwrap && nextX >= _width) break;
+			nextX += textAdvance(buffer[n + count++]);
+			if (_textwrap && nextX > _width - textCellWidth()) break;
+		}
+		if (count == 0 || !charInBounds(_cursorX, _cursorY))
+		{
+			write(buffer[n++]);
+			continue;
+		}
+		if (writeTextRun(_cursorX, _cursorY, buffer + n, count) != rvlDisplay_Success) break;
+		n += count;
+		_cursorX = nextX;
+		if (_textwrap && (_cursorX  > (_width - textCellWidth())))
+		{
+			_cursorY += textCellHeight();
+			_cursorX = 0;
+		}
+	}
+	return n;
+}
+
 /*!
 	@brief Set text color foreground and background
 	@param c text foreground color , Color definitions 16-Bit Color Values R5G6B5
@@ -984,6 +2008,58 @@ void color16_graphics::setTextColor(uint16_t c) {
 	_textcolor   = c;
 }
 
+/*!
+	@brief Get text color foreground
+	@return text foreground color R5G6B5
+*/
+uint16_t color16_graphics::getTextColor(void) {
+	return _textcolor;
+}
+
+/*!
+	@brief Get text color background
+	@return text background color R5G6B5
+*/
+uint16_t color16_graphics::getTextBgColor(void) {
+	return _textbgcolor;
+}
+
+/*!
+	@brief Attach a cache of rendered glyphs used by writeChar, writeCharString and print
+	@param cache the cache, owned by the caller, nullptr to detach
+	@note Glyphs are keyed by font, character, text colors and inversion, so
+		changing any of them needs no call here. One cache may be shared by several displays.
+*/
+void color16_graphics::setGlyphCache(glyphCache* cache)
+{
+	_glyphCache = cache;
+}
+
+/*!
+	@brief Turn on or off transparent text
+	@param transparent true, writeChar, writeCharString and print send only the
+		glyph pixels, in the foreground color (background color if the font is
+		inverted), and leave the background as it is. false, the whole character
+		cell is painted, the default.
+	@note Glyph pixels go as horizontal runs, one address window per run,
+		runs stacked on consecutive rows merged. The controller has no
+		scattered write, so each window costs 11 bytes of commands before its
+		pixels. Best for text over images, and for larger fonts, where the runs
+		are long: "HELLO 0123" in Orla is 1949 bytes against 7691 opaque, in
+		Pico it is 554 bytes against 491 opaque.
+*/
+void color16_graphics::setTextTransparent(bool transparent) {
+	_textTransparent = transparent;
+}
+
+/*!
+	@brief Get transparent text mode
+	@return true if text draws glyph pixels only
+*/
+bool color16_graphics::getTextTransparent(void) {
+	return _textTransparent;
+}
+
 /*!
 	@brief turn on or off screen wrap of the text (fonts 1-6)
 	@param w TRUE on
@@ -991,4 +2067,16 @@ void color16_graphics::setTextColor(uint16_t c) {
 void color16_graphics::setTextWrap(bool w) {
 	_textwrap = w;
 }
+
+/*!
+	@brief Draw one video frame, one address window and one SPI write, see drawBitmap565
+	@param pFrame big endian RGB565 pixels, rows top down
+	@param w frame width in pixels
+	@param h frame height in pixels
+	@return enum rvlDisplay_Return_Codes_e from drawBitmap565
+*/
+rvlDisplay_Return_Codes_e rvlDisplayFrameSink::writeFrame(const uint8_t* pFrame, uint16_t w, uint16_t h)
+{
+	return _display.drawBitmap565(_x, _y, pFrame, w, h);
+}
 // **************** EOF *****************
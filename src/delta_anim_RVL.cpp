@@ -0,0 +1,398 @@
+/*!
+	@file     delta_anim_RVL.cpp
+	@author   Gavin Lyons
+	@brief    Delta frame animation container, encoder and reader.
+				Project Name: ST7789_TFT_RPI
+*/
+
+#include <iostream>
+#include <cstring>
+#include <algorithm>
+#include <new>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include "../include/delta_anim_RVL.hpp"
+#include "../include/rle565_RVL.hpp"
+
+/*! @brief Rectangle of changed pixels found by the encoder */
+struct AnimDiffRect_t
+{
+	uint16_t x, y, w, h;
+};
+
+static void PutBytes(std::vector<uint8_t>& out, const void* pData, size_t len)
+{
+	out.insert(out.end(), (const uint8_t*)pData, (const uint8_t*)pData + len);
+}
+
+/*!
+	@brief Find the rectangles that cover the pixels changed between two frames
+	@param pPrev previous frame, big endian RGB565, nullptr for the whole frame
+	@param pCur current frame
+	@param w frame width in pixels
+	@param h frame height in pixels
+	@param rects receives the rectangles, replaced
+	@details The frame is split into RVL_ANIM_TILE square tiles and a tile is
+		dirty if any pixel in it changed. Runs of dirty tiles across a tile row
+		are grown down while every tile below is dirty too, then each rectangle
+		is trimmed to the bounding box of its changed pixels.
+*/
+static void DiffFrames(const uint8_t* pPrev, const uint8_t* pCur, uint16_t w, uint16_t h,
+	std::vector<AnimDiffRect_t>& rects)
+{
+	rects.clear();
+	if (pPrev == nullptr)
+	{
+		rects.push_back({0, 0, w, h});
+		return;
+	}
+	auto changed = [&](uint32_t px, uint32_t py) {
+		size_t i = ((size_t)py * w + px) * 2;
+		return pPrev[i] != pCur[i] || pPrev[i + 1] != pCur[i + 1];
+	};
+	const uint16_t tilesX = (w + RVL_ANIM_TILE - 1) / RVL_ANIM_TILE;
+	const uint16_t tilesY = (h + RVL_ANIM_TILE - 1) / RVL_ANIM_TILE;
+	// 0 clean, 1 dirty, 2 dirty and covered by a rectangle
+	std::vector<uint8_t> tiles((size_t)tilesX * tilesY, 0);
+	for (uint16_t py = 0; py < h; py++)
+	{
+		const uint8_t* a = pPrev + (size_t)py * w * 2;
+		const uint8_t* b = pCur + (size_t)py * w * 2;
+		if (memcmp(a, b, (size_t)w * 2) == 0) continue;
+		for (uint16_t px = 0; px < w; px++)
+			if (changed(px, py)) tiles[(py / RVL_ANIM_TILE) * tilesX + px / RVL_ANIM_TILE] = 1;
+	}
+	for (uint16_t ty = 0; ty < tilesY; ty++)
+	{
+		for (uint16_t tx = 0; tx < tilesX; )
+		{
+			if (tiles[ty * tilesX + tx] != 1) { tx++; continue; }
+			uint16_t tx1 = tx;
+			while (tx1 + 1 < tilesX && tiles[ty * tilesX + tx1 + 1] == 1) tx1++;
+			uint16_t ty1 = ty;
+			for (bool grow = true; grow && ty1 + 1 < tilesY; )
+			{
+				for (uint16_t i = tx; i <= tx1 && grow; i++) grow = (tiles[(ty1 + 1) * tilesX + i] == 1);
+				if (grow) ty1++;
+			}
+			for (uint16_t j = ty; j <= ty1; j++)
+				for (uint16_t i = tx; i <= tx1; i++) tiles[j * tilesX + i] = 2;
+			// Trim to the changed pixels
+			uint16_t x0 = tx * RVL_ANIM_TILE, y0 = ty * RVL_ANIM_TILE;
+			uint16_t x1 = std::min<uint32_t>((tx1 + 1) * RVL_ANIM_TILE, w) - 1;
+			uint16_t y1 = std::min<uint32_t>((ty1 + 1) * RVL_ANIM_TILE, h) - 1;
+			uint16_t minX = x1, maxX = x0, minY = y1, maxY = y0;
+			for (uint16_t py = y0; py <= y1; py++)
+				for (uint16_t px = x0; px <= x1; px++)
+					if (changed(px, py))
+					{
+						if (px < minX) minX = px;
+						if (px > maxX) maxX = px;
+						if (py < minY) minY = py;
+						if (py > maxY) maxY = py;
+					}
+			rects.push_back({minX, minY, (uint16_t)(maxX - minX + 1), (uint16_t)(maxY - minY + 1)});
+			tx = tx1 + 1;
+		}
+	}
+}
+
+/*!
+	@brief Append one frame, its header and changed rectangles, to an encoded animation
+	@param out encoded animation
+	@param pPrev previous frame or nullptr for a whole frame
+	@param pCur frame to encode
+	@param w frame width in pixels
+	@param h frame height in pixels
+	@param delayMs time the frame is shown
+*/
+static void PutFrame(std::vector<uint8_t>& out, const uint8_t* pPrev, const uint8_t* pCur,
+	uint16_t w, uint16_t h, uint16_t delayMs)
+{
+	std::vector<AnimDiffRect_t> rects;
+	DiffFrames(pPrev, pCur, w, h, rects);
+	rvlAnim_FrameHeader_t frame;
+	frame.delayMs = delayMs;
+	frame.rects = rects.size();
+	PutBytes(out, &frame, sizeof(frame));
+
+	std::vector<uint8_t> raw, rle;
+	for (const AnimDiffRect_t& r : rects)
+	{
+		raw.resize((size_t)r.w * r.h * 2);
+		for (uint16_t j = 0; j < r.h; j++)
+			memcpy(raw.data() + (size_t)j * r.w * 2, pCur + ((size_t)(r.y + j) * w + r.x) * 2, (size_t)r.w * 2);
+		RLE565Encode(raw.data(), r.w, r.h, rle);
+		const bool useRLE = rle.size() < raw.size();
+		const std::vector<uint8_t>& data = useRLE ? rle : raw;
+
+		rvlAnim_RectHeader_t header = {};
+		header.x = r.x;
+		header.y = r.y;
+		header.w = r.w;
+		header.h = r.h;
+		header.encoding = useRLE ? RVL_ANIM_RLE565 : RVL_ANIM_RAW565;
+		header.length = data.size();
+		PutBytes(out, &header, sizeof(header));
+		PutBytes(out, data.data(), data.size());
+		out.resize((out.size() + 3) & ~(size_t)3, 0);
+	}
+}
+
+/*!
+	@brief Encode a sequence of frames as a delta frame animation
+	@param pFrames count frames, each w*h big endian RGB565 pixels, rows top down
+	@param count number of frames, 1 or more
+	@param w frame width in pixels
+	@param h frame height in pixels
+	@param pDelays time each frame is shown, milliseconds, count values
+	@param out receives the animation, replaced
+	@note Frame 0 is stored whole, every other frame as its change from the
+		frame before. With more than one frame a loop frame, last back to
+		frame 0, is added. Header fields are written in host order.
+*/
+void DeltaAnimEncode(const uint8_t* const* pFrames, uint16_t count, uint16_t w, uint16_t h,
+	const uint16_t* pDelays, std::vector<uint8_t>& out)
+{
+	out.clear();
+	rvlAnim_Header_t header = {};
+	memcpy(header.magic, RVL_ANIM_MAGIC, 4);
+	header.version = RVL_ANIM_VERSION;
+	header.flags = (count > 1) ? RVL_ANIM_FLAG_LOOP : 0;
+	header.width = w;
+	header.height = h;
+	header.frames = count;
+	PutBytes(out, &header, sizeof(header));
+	for (uint16_t i = 0; i < count; i++)
+		PutFrame(out, (i == 0) ? nullptr : pFrames[i - 1], pFrames[i], w, h, pDelays[i]);
+	if (count > 1)
+		PutFrame(out, pFrames[count - 1], pFrames[0], w, h, pDelays[0]);
+}
+
+/*!
+	@brief Destructor, closes any open animation
+*/
+deltaAnimation::~deltaAnimation()
+{
+	close();
+}
+
+/*!
+	@brief Map an animation file and index its frames
+	@param path file system path of the animation
+	@return enum rvlDisplay_Return_Codes_e
+		-# rvlDisplay_Success for success
+		-# rvlDisplay_FileOpen file could not be opened or mapped
+		-# rvlDisplay_FileFormat not an animation, wrong version or a frame outside the file
+		-# rvlDisplay_MallocError no memory for the index
+*/
+rvlDisplay_Return_Codes_e deltaAnimation::open(const char* path)
+{
+	close();
+	int fd = (path == nullptr) ? -1 : ::open(path, O_RDONLY);
+	struct stat st;
+	if (fd < 0 || fstat(fd, &st) != 0 || st.st_size < (off_t)sizeof(rvlAnim_Header_t))
+	{
+		std::cout << "Error deltaAnimation open 1: File could not be opened : " << (path ? path : "nullptr") << std::endl;
+		if (fd >= 0) ::close(fd);
+		return rvlDisplay_FileOpen;
+	}
+	void* pMap = mmap(nullptr, st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+	::close(fd); // mapping holds its own reference
+	if (pMap == MAP_FAILED)
+	{
+		std::cout << "Error deltaAnimation open 2: mmap failed" << std::endl;
+		return rvlDisplay_FileOpen;
+	}
+	_pData = (const uint8_t*)pMap;
+	_size = st.st_size;
+	_mapped = true;
+	return readIndex();
+}
+
+/*!
+	@brief Open an animation held in memory
+	@param pData animation data, must stay valid while the animation is open
+	@param len bytes of animation data
+	@return enum rvlDisplay_Return_Codes_e
+		-# rvlDisplay_Success for success
+		-# rvlDisplay_BitmapNullptr pData is nullptr
+		-# rvlDisplay_FileFormat, rvlDisplay_MallocError see open(path)
+*/
+rvlDisplay_Return_Codes_e deltaAnimation::open(const uint8_t* pData, size_t len)
+{
+	close();
+	if (pData == nullptr)
+	{
+		std::cout << "Error deltaAnimation open 3: data is nullptr" << std::endl;
+		return rvlDisplay_BitmapNullptr;
+	}
+	_pData = pData;
+	_size = len;
+	return readIndex();
+}
+
+/*!
+	@brief Close the animation, rectangle data pointers from it are no longer valid
+*/
+void deltaAnimation::close(void)
+{
+	if (_mapped && _pData != nullptr) munmap((void*)_pData, _size);
+	_pData = nullptr;
+	_size = 0;
+	_mapped = false;
+	delete[] _frames;
+	_frames = nullptr;
+	delete[] _rects;
+	_rects = nullptr;
+	_rectCount = 0;
+	_width = _height = _frameCount = 0;
+	_hasLoop = false;
+}
+
+/*!
+	@brief Get a frame
+	@param index 0 to frameCount()-1, or frameCount() for the loop frame
+	@return pointer to the frame or nullptr if index is out of range
+*/
+const rvlAnimFrame_t* deltaAnimation::frame(uint16_t index) const
+{
+	uint32_t frames = _frameCount + (_hasLoop ? 1 : 0);
+	return (index < frames) ? &_frames[index] : nullptr;
+}
+
+/*!
+	@brief Get a rectangle
+	@param index rvlAnimFrame_t::firstRect plus 0 to rectCount-1
+	@return pointer to the rectangle or nullptr if index is out of range
+*/
+const rvlAnimRect_t* deltaAnimation::rect(uint32_t index) const
+{
+	return (index < _rectCount) ? &_rects[index] : nullptr;
+}
+
+/*!
+	@brief Bytes sent to the display for one loop of the animation once it is running
+	@return bus bytes of frames 1 to frameCount()-1 plus the loop frame, or frame 0
+		if there is no loop frame
+*/
+uint32_t deltaAnimation::loopBusBytes(void) const
+{
+	if (_frameCount == 0) return 0;
+	uint32_t bytes = _frames[_hasLoop ? _frameCount : 0].busBytes;
+	for (uint16_t i = 1; i < _frameCount; i++) bytes += _frames[i].busBytes;
+	return bytes;
+}
+
+/*!
+	@brief Check the header and every frame, then build the frame and rectangle index
+	@return enum rvlDisplay_Return_Codes_e, see open
+	@details Two passes, the first checks the layout and counts rectangles, the
+		second fills the index.
+*/
+rvlDisplay_Return_Codes_e deltaAnimation::readIndex(void)
+{
+	rvlAnim_Header_t header = {};
+	if (_size >= sizeof(header)) memcpy(&header, _pData, sizeof(header));
+	if (memcmp(header.magic, RVL_ANIM_MAGIC, 4) != 0 || header.version != RVL_ANIM_VERSION)
+	{
+		std::cout << "Error deltaAnimation open 4: Not an animation file or wrong version" << std::endl;
+		close();
+		return rvlDisplay_FileFormat;
+	}
+	const bool hasLoop = (header.flags & RVL_ANIM_FLAG_LOOP) != 0;
+	const uint32_t frames = header.frames + (hasLoop ? 1 : 0);
+
+	for (uint8_t pass = 0; pass < 2; pass++)
+	{
+		size_t pos = sizeof(header);
+		uint32_t rectIndex = 0;
+		for (uint32_t f = 0; f < frames; f++)
+		{
+			rvlAnim_FrameHeader_t frameHeader;
+			if (_size - pos < sizeof(frameHeader))
+			{
+				std::cout << "Error deltaAnimation open 5: Frame " << f << " outside the file" << std::endl;
+				close();
+				return rvlDisplay_FileFormat;
+			}
+			memcpy(&frameHeader, _pData + pos, sizeof(frameHeader));
+			pos += sizeof(frameHeader);
+			if (pass == 1)
+			{
+				_frames[f].delayMs = frameHeader.delayMs;
+				_frames[f].rectCount = frameHeader.rects;
+				_frames[f].firstRect = rectIndex;
+				_frames[f].busBytes = 0;
+			}
+			for (uint16_t r = 0; r < frameHeader.rects; r++, rectIndex++)
+			{
+				rvlAnim_RectHeader_t rectHeader;
+				const uint8_t* pRect = nullptr;
+				bool valid = (_size - pos >= sizeof(rectHeader));
+				if (valid)
+				{
+					memcpy(&rectHeader, _pData + pos, sizeof(rectHeader));
+					pos += sizeof(rectHeader);
+					pRect = _pData + pos;
+					valid = rectHeader.w > 0 && rectHeader.h > 0 &&
+						(uint32_t)rectHeader.x + rectHeader.w <= header.width &&
+						(uint32_t)rectHeader.y + rectHeader.h <= header.height &&
+						rectHeader.length <= _size - pos;
+					if (valid && rectHeader.encoding == RVL_ANIM_RAW565)
+					{
+						valid = (rectHeader.length == (uint32_t)rectHeader.w * rectHeader.h * 2);
+					} else if (valid && rectHeader.encoding == RVL_ANIM_RLE565) {
+						rvlRLE565_Header_t rle;
+						valid = (rectHeader.length >= sizeof(rle));
+						if (valid) memcpy(&rle, pRect, sizeof(rle));
+						valid = valid && memcmp(rle.magic, RVL_RLE565_MAGIC, 4) == 0 &&
+							rle.width == rectHeader.w && rle.height == rectHeader.h;
+					} else {
+						valid = false;
+					}
+					pos += std::min<size_t>((rectHeader.length + 3) & ~(uint32_t)3, _size - pos);
+				}
+				if (!valid)
+				{
+					std::cout << "Error deltaAnimation open 6: Bad rectangle " << r << " in frame " << f << std::endl;
+					close();
+					return rvlDisplay_FileFormat;
+				}
+				if (pass == 1)
+				{
+					rvlAnimRect_t& rect = _rects[rectIndex];
+					rect.x = rectHeader.x;
+					rect.y = rectHeader.y;
+					rect.w = rectHeader.w;
+					rect.h = rectHeader.h;
+					rect.encoding = (rvlAnim_Encoding_e)rectHeader.encoding;
+					rect.length = rectHeader.length;
+					rect.data = pRect;
+					_frames[f].busBytes += RVL_ANIM_WINDOW_BYTES + (uint32_t)rect.w * rect.h * 2;
+				}
+			}
+		}
+		if (pass == 0)
+		{
+			_frames = new (std::nothrow) rvlAnimFrame_t[frames ? frames : 1];
+			_rects = new (std::nothrow) rvlAnimRect_t[rectIndex ? rectIndex : 1];
+			if (_frames == nullptr || _rects == nullptr)
+			{
+				std::cout << "Error deltaAnimation open 7: could not assign memory for index" << std::endl;
+				close();
+				return rvlDisplay_MallocError;
+			}
+			_rectCount = rectIndex;
+		}
+	}
+	_width = header.width;
+	_height = header.height;
+	_frameCount = header.frames;
+	_hasLoop = hasLoop;
+	return rvlDisplay_Success;
+}
+
+// **************** EOF *****************
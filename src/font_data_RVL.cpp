@@ -5,9 +5,91 @@
 	@note For font , total characters = (ASCII offset - ASCII last character)
 */
 
+#include <cstring>
 #include "../../include/font_data_RVL.hpp"
 
 // === Font class implementation ===
+
+/*!
+	@brief Expand one glyph of a fixed font to big endian RGB565 pixels
+	@tparam L glyph bit layout
+	@tparam W font width, 0 to use the width argument
+	@tparam H font height, 0 to use the height argument
+	@param pGlyph glyph data
+	@param pDst destination of the top left pixel
+	@param stride bytes from one row of pDst to the next
+	@param color foreground color
+	@param bgcolor background color
+	@param width font width, when W is 0
+	@param height font height, when H is 0
+	@details With W and H set every loop has a constant trip count and is
+		unrolled, each pixel picks its color with a bit mask instead of a branch.
+		Banded glyphs are expanded a pixel row at a time so the stores are in order.
+ */
+template <rvlFontLayout_e L, uint8_t W, uint8_t H>
+static void renderGlyphFixed(const uint8_t* pGlyph, uint8_t* pDst, uint32_t stride,
+	uint16_t color, uint16_t bgcolor, uint8_t width, uint8_t height)
+{
+	const uint8_t fontW = W ? W : width;
+	const uint8_t fontH = H ? H : height;
+	// Colors held in display byte order, the mask selects whole pixels so host order does not matter
+	const uint8_t bgBytes[2] = {(uint8_t)(bgcolor >> 8), (uint8_t)bgcolor};
+	const uint8_t diffBytes[2] = {(uint8_t)((color ^ bgcolor) >> 8), (uint8_t)(color ^ bgcolor)};
+	uint16_t bgPixel, diffPixel;
+	memcpy(&bgPixel, bgBytes, 2);
+	memcpy(&diffPixel, diffBytes, 2);
+	auto put = [&](uint8_t* p, uint8_t bit) {
+		const uint16_t pixel = bgPixel ^ (diffPixel & (uint16_t)-bit);
+		memcpy(p, &pixel, 2);
+	};
+	if constexpr (L == rvlFontLayout_Banded)
+	{
+		for (uint16_t band = 0; band < fontH / 8; band++, pGlyph += fontW)
+		{
+			for (uint8_t i = 0; i < 8; i++)
+			{
+				uint8_t* p = pDst + (band * 8 + i) * stride;
+				for (uint16_t cx = 0; cx < fontW; cx++)
+					put(p + cx * 2, (pGlyph[cx] >> i) & 1);
+			}
+		}
+	} else
+	{
+		uint32_t bit = 0;
+		for (uint16_t cx = 0; cx < fontW; cx++)
+		{
+			for (uint16_t cy = 0; cy < fontH; cy++, bit++)
+				put(pDst + cy * stride + cx * 2, (pGlyph[bit >> 3] >> (7 - (bit & 7))) & 1);
+		}
+	}
+}
+
+/*!
+	@brief Pick the glyph renderer for a fixed font
+	@param info font geometry
+	@return a renderer built for the font size if it is a common one,
+		else the renderer for any size of the font's layout
+	@note font_pico, 4 by 6, is the only column layout font in rvlFontInfo.
+ */
+static rvlGlyphRenderer_t glyphRendererFor(const rvlFontInfo_t& info)
+{
+	if (info.layout() == rvlFontLayout_Columns)
+	{
+		if (info.width == 4 && info.height == 6)
+			return renderGlyphFixed<rvlFontLayout_Columns, 4, 6>;
+		return renderGlyphFixed<rvlFontLayout_Columns, 0, 0>;
+	}
+	switch ((info.width << 8) | info.height)
+	{
+		case (6 << 8) | 8 : return renderGlyphFixed<rvlFontLayout_Banded, 6, 8>;
+		case (8 << 8) | 8 : return renderGlyphFixed<rvlFontLayout_Banded, 8, 8>;
+		case (16 << 8) | 16 : return renderGlyphFixed<rvlFontLayout_Banded, 16, 16>;
+		case (16 << 8) | 24 : return renderGlyphFixed<rvlFontLayout_Banded, 16, 24>;
+		case (16 << 8) | 32 : return renderGlyphFixed<rvlFontLayout_Banded, 16, 32>;
+		default: return renderGlyphFixed<rvlFontLayout_Banded, 0, 0>;
+	}
+}
+
 /*!
 	@brief init the OLED  font class object constructor
  */
@@ -44,6 +126,8 @@ rvlDisplay_Return_Codes_e display_Fonts::setFont(display_Font_name_e FontChoice)
 		case font_groTesk : SelectedFontName =  pFontGroTesk; break;
 		case font_mint : SelectedFontName =  pFontMint; break;
 		case font_sixteenSeg : SelectedFontName = pFontSixteenSeg; break;
+		case font_defaultProp : return setFont(pFontDefaultProp);
+		case font_arialBoldProp : return setFont(pFontArialBoldProp);
 		default: 
 			printf("setFont ERROR 1: invalid font choice \n");
 			return rvlDisplay_WrongFont;
@@ -56,16 +140,68 @@ rvlDisplay_Return_Codes_e display_Fonts::setFont(display_Font_name_e FontChoice)
 		return rvlDisplay_FontPtrNullptr;
 	}
 
+	const rvlFontInfo_t& info = rvlFontInfo[FontChoice - 1];
 	_FontSelect   = SelectedFontName;
-	_Font_X_Size  = *(SelectedFontName + 0);
-	_Font_Y_Size  = *(SelectedFontName + 1);
-	_FontOffset   = *(SelectedFontName + 2);
-	_FontNumChars = *(SelectedFontName + 3);
+	_Font_X_Size  = info.width;
+	_Font_Y_Size  = info.height;
+	_FontOffset   = info.offset;
+	_FontNumChars = info.numChars;
+	_FontRenderer = glyphRendererFor(info);
+	_FontGlyphBytes = info.glyphBytes();
+	_FontProp     = nullptr;
 	_FontInverted = false;
+	_FontName     = FontChoice;
+
+	return rvlDisplay_Success;
+}
 
+/*!
+	@brief SetFont, select a proportional font
+	@param font the font, see rvlPropFont_t, must stay valid while selected
+	@return	Will return rvlDisplay_Return_Codes_e  enum
+		-# Pass rvlDisplay_Success
+		-# Error 1 rvlDisplay_FontPtrNullptr
+		-# Error 2 rvlDisplay_WrongFont
+	@note The font's maxAdvance is used as the font width for wrapping and
+		bounds checks, each character is drawn in a cell of its own advance.
+ */
+rvlDisplay_Return_Codes_e display_Fonts::setFont(const rvlPropFont_t* font) {
+	if (font == nullptr || font->bitmap == nullptr || font->glyphs == nullptr)
+	{
+		printf("setFont ERROR 1: Invalid pointer object\r\n");
+		return rvlDisplay_FontPtrNullptr;
+	}
+	if (font->first > font->last || font->last > 0x7F || font->height == 0 || font->maxAdvance == 0)
+	{
+		printf("setFont ERROR 2: invalid proportional font \n");
+		return rvlDisplay_WrongFont;
+	}
+	_FontProp     = font;
+	_FontSelect   = nullptr;
+	_Font_X_Size  = font->maxAdvance;
+	_Font_Y_Size  = font->height;
+	_FontOffset   = font->first;
+	_FontNumChars = font->last - font->first;
+	_FontRenderer = nullptr;
+	_FontInverted = false;
 	return rvlDisplay_Success;
 }
 
+/*!
+	@brief getFont
+	@return the last fixed font selected by name, see getPropFont for
+		a proportional font
+*/
+display_Font_name_e display_Fonts::getFont(void)
+{ return _FontName; }
+
+/*!
+	@brief getPropFont
+	@return the active proportional font, nullptr if a fixed font is active
+*/
+const rvlPropFont_t* display_Fonts::getPropFont(void)
+{ return _FontProp; }
+
 /*!
 	@brief setInvertFont
 	@param invertStatus set the invert status flag of font ,false = off.
@@ -81,6 +217,59 @@ void display_Fonts::setInvertFont(bool invertStatus) {
 bool display_Fonts::getInvertFont()
 { return _FontInverted; }
 
+/*!
+	@brief getFontProportional
+	@return true if a proportional font is selected
+*/
+bool display_Fonts::getFontProportional(void)
+{ return _FontProp != nullptr; }
+
+/*!
+	@brief Width of a text in the current font and text scale, as writeCharString draws it on one line
+	@param pText null terminated text
+	@return width in pixels, characters outside the font count as the font width
+*/
+uint16_t display_Fonts::getTextWidth(const char* pText)
+{
+	if (pText == nullptr) return 0;
+	uint32_t width = 0;
+	for (; *pText != '\0'; pText++)
+	{
+		const char value = *pText;
+		const bool inRange = value >= _FontOffset && value < (_FontOffset + _FontNumChars + 1);
+		width += inRange ? textAdvance(value) : textCellWidth();
+	}
+	return (width > UINT16_MAX) ? UINT16_MAX : width;
+}
+
+/*!
+	@brief Set the text scale factor, glyphs are drawn scale times wider and higher
+	@param scale 1 to RVL_TEXT_SCALE_MAX, 1 is normal size
+	@return	Will return rvlDisplay_Return_Codes_e  enum
+		-# Pass rvlDisplay_Success
+		-# Error 1 rvlDisplay_TextScale
+	@note Pixels are replicated as each glyph is expanded into its buffer, so
+		a scaled character is still sent in one address window. Applies to
+		every font and to writeChar, writeCharString and print, the scale is
+		kept when the font is changed.
+*/
+rvlDisplay_Return_Codes_e display_Fonts::setTextScale(uint8_t scale) {
+	if (scale < 1 || scale > RVL_TEXT_SCALE_MAX)
+	{
+		printf("setTextScale ERROR 1: scale must be 1 to %u\n", RVL_TEXT_SCALE_MAX);
+		return rvlDisplay_TextScale;
+	}
+	_textScale = scale;
+	return rvlDisplay_Success;
+}
+
+/*!
+	@brief getTextScale
+	@return the text scale factor, 1 is normal size
+*/
+uint8_t display_Fonts::getTextScale(void)
+{ return _textScale; }
+
 // === End of Font class implementation ===
 
 
@@ -90,7 +279,7 @@ bool display_Fonts::getInvertFont()
 	Full Ascii Range 0-0xFF
 	Memory usage : 1534 bytes
 */
-static const uint8_t FontDefault[1534]  = {
+static constexpr uint8_t FontDefault[1534]  = {
 0x06, 0x08, 0x00, 0xFF, // x_size, y_size, offset, total characters,
 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
 0x00, 0x3E, 0x5B, 0x4F, 0x5B, 0x3E,  // :)
@@ -354,7 +543,7 @@ static const uint8_t FontDefault[1534]  = {
 	Font size: 5x8 pixels
 	Memory usage : 74 bytes
 */
-static const uint8_t FontSevenSeg[74]=
+static constexpr uint8_t FontSevenSeg[74]=
 {
 0x05, 0x08, 0x2D, 0x0D, // x_size, y_size, offset, total characters,
 0x00,0x08,0x08,0x00,0x00, // -
@@ -379,7 +568,7 @@ static const uint8_t FontSevenSeg[74]=
 	Note: Thick font NO lowercase letters, font ends at 'Z'
 	Memory usage : 476 bytes
 */
-static const uint8_t FontThick[476]=
+static constexpr uint8_t FontThick[476]=
 {
 0x08, 0x08, 0x20, 0x3A, // x_size, y_size, offset, total characters,
 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, //  
@@ -448,7 +637,7 @@ static const uint8_t FontThick[476]=
 	NO lowercase letters, font ends at 'Z'
 	Memory usage : 535 bytes
 */
-static const uint8_t FontWide[535]  = {
+static constexpr uint8_t FontWide[535]  = {
 0x09, 0x08, 0x20, 0x3A, // x_size, y_size, offset, total characters,
 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, //
 0x00,0x00,0x00,0x00,0x5F,0x00,0x00,0x00,0x00, // !
@@ -517,7 +706,7 @@ static const uint8_t FontWide[535]  = {
 	Small font based on the character set from the Sinclair ZX Spectrum.
 	Memory usage : 764 bytes
 */
-static const uint8_t FontSinclairS[764]=
+static constexpr uint8_t FontSinclairS[764]=
 {
 0x08,0x08,0x20,0x5F,
 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // <space>
@@ -626,7 +815,7 @@ static const uint8_t FontSinclairS[764]=
 	Font type: Full font (95 chars)
 	Pico font X by Y 4 by 6.
 */
-static const uint8_t FontPICO[] =
+static constexpr uint8_t FontPICO[] =
 {
 0x04, 0x06, 0x20, 0x5f,   // x-size, y-size, offset, total characters
 0x00, 0x00, 0x00, 0x03, 0xa0, 0x00, 0xc0, 0x0c, 0x00, 0xf9, 0x4f, 0x80, 0x6b, 0xeb, 0x00, 0x98, 0x8c, 0x80, 0x52, 0xa5, 0x80, 0x03, 0x00, 0x00,  // Space, !"#$%&'
@@ -649,7 +838,7 @@ static const uint8_t FontPICO[] =
 	Font size    : 16x24 pixels
 	Memory usage : 4564 bytes
 */
-static const uint8_t FontOrla[4564]={
+static constexpr uint8_t FontOrla[4564]={
 0x10,0x18,0x20,0x5F,
 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // <space>
 0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0xFE,0xFE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1F,0x1F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0x07,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // !
@@ -759,7 +948,7 @@ static const uint8_t FontOrla[4564]={
  Font size    : 8x16 pixels
  Memory usage : 1524 bytes
 */
-static const uint8_t FontRetro[1524]={
+static constexpr uint8_t FontRetro[1524]={
 0x08,0x10,0x20,0x5F,
 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // <space>
 0x00,0x00,0x00,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x33,0x00,0x00,0x00,0x00,  // !
@@ -868,7 +1057,7 @@ static const uint8_t FontRetro[1524]={
 	MEGA font X by Y  = 16 by 16 .
 	EG 128/16 by 64/16 = 8 by 4 = 32 characters
 */
-static const uint8_t FontMEGA[3044] = {   // Size is 16x16 (NB 0x10 = 16 decimal)
+static constexpr uint8_t FontMEGA[3044] = {   // Size is 16x16 (NB 0x10 = 16 decimal)
 0x10,0x10,0x20,0x5F,  // x-size, y-size, offset, total characters
 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // <space>
 0x00,0x00,0x00,0x00,0xF8,0xFC,0xFC,0xFC,0xF8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x73,0x73,0x73,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // !
@@ -977,7 +1166,7 @@ static const uint8_t FontMEGA[3044] = {   // Size is 16x16 (NB 0x10 = 16 decimal
 	Font size: 16x16 pixels
 	Medium sized font based on the PC Arial TTF type font with bold font weight.
 */
-static const uint8_t FontArialBold[3044] =
+static constexpr uint8_t FontArialBold[3044] =
 {
 0x10,0x10,0x20,0x5F,  // x-size, y-size, offset, total characters
 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // <space>
@@ -1087,7 +1276,7 @@ static const uint8_t FontArialBold[3044] =
 	Font size: 16x16 pixels
 	Medium sized font based on the Hall Fetica medium TTF type font with normal font weight.
 */
-static const uint8_t  FontHallfetica[3044] =
+static constexpr uint8_t FontHallfetica[3044] =
 {
 0x10,0x10,0x20,0x5F,  // x-size, y-size, offset, total characters
 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // <space>
@@ -1197,7 +1386,7 @@ static const uint8_t  FontHallfetica[3044] =
 	Font size: 16x24 pixels
 	Arial Round 24px
 */
-static const uint8_t FontArialRound[4564] =
+static constexpr uint8_t FontArialRound[4564] =
 {
 0x10,0x18,0x20,0x5F,  // x-size, y-size, offset, total characters
 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // <space>
@@ -1307,7 +1496,7 @@ static const uint8_t FontArialRound[4564] =
 	Font size: 16x32 pixels
 	Grotesk,  This is a clear reading, modern sans-serif font.
 */
-static const uint8_t FontGrotesk[5828] ={
+static constexpr uint8_t FontGrotesk[5828] ={
 0x10,0x20,0x20,0x5A,  // x-size, y-size, offset, total characters
 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // <space>
 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF8,0xF8,0xF8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0x07,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0F,0x0F,0x0F,0x00,0x00,0x00,0x00,0x00,0x00,  // !
@@ -1415,7 +1604,7 @@ static const uint8_t FontGrotesk[5828] ={
 	Creators notes: The character before the lowercase 'a' is normally a grave accent,
 	but have been changed to the 'º' character to be able to show °C on the screen.
 */
-static const uint8_t FontMint[8740] ={
+static constexpr uint8_t FontMint[8740] ={
 0x18,0x20,0x20,0x5A,
 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // <space>
 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFE,0xFE,0xFE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE0,0xF1,0xF1,0xF0,0xE0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x01,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // !
@@ -1520,7 +1709,7 @@ static const uint8_t FontMint[8740] ={
 	Font size: 32x48 pixels
 	This is a clear reading sixteen-segment font with some special symbols / . - :
 */
-static const uint8_t FontSixteenSeg[2692] =
+static constexpr uint8_t FontSixteenSeg[2692] =
 {
 0x20,0x30,0x2D,0x0D,  // x-size, y-size, offset, total characters
 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0x80,0x00,0x00,0x80,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x03,0x03,0x03,0x03,0x03,0x03,0x03,0x03,0x03,0x01,0x00,0x00,0x01,0x03,0x03,0x03,0x03,0x03,0x03,0x03,0x03,0x03,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // -
@@ -1539,6 +1728,343 @@ static const uint8_t FontSixteenSeg[2692] =
 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0xF0,0xF0,0x60,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x06,0x0E,0x0E,0x06,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // :
 };
 
+/*!
+	Font type: Proportional font (95 chars)
+	Proportional version of the default font, 8 pixels high, glyphs trimmed to their ink
+	Memory usage : 379 bytes bitmap, 95 glyphs
+*/
+static const uint8_t FontDefaultPropBitmap[379] =
+{
+0xFA,0xB6,0x80,0x52,0xBE,0xAF,0xA9,0x40,0x23,0xE8,0xE2,0xF8,0x80,0xC6,0x44,0x44,
+0x4C,0x60,0x45,0x28,0x8A,0xC9,0xA0,0x6D,0x40,0x2A,0x48,0x88,0x88,0x92,0xA0,0x25,
+0x5D,0xF7,0x54,0x80,0x21,0x3E,0x42,0x00,0x6D,0x40,0xF8,0xF0,0x08,0x88,0x88,0x00,
+0x74,0x67,0x5C,0xC5,0xC0,0x59,0x24,0xB8,0x74,0x42,0xE8,0x43,0xE0,0xF8,0x44,0x60,
+0xC5,0xC0,0x11,0x95,0x2F,0x88,0x40,0xFC,0x3C,0x10,0xC5,0xC0,0x3A,0x21,0xE8,0xC5,
+0xC0,0xF8,0x42,0x22,0x22,0x00,0x74,0x62,0xE8,0xC5,0xC0,0x74,0x62,0xF0,0x8B,0x80,
+0xA0,0x45,0x80,0x12,0x48,0x42,0x10,0xF8,0x3E,0x84,0x21,0x24,0x80,0x74,0x42,0x62,
+0x00,0x80,0x74,0x6B,0x7B,0x41,0xE0,0x22,0xA3,0x1F,0xC6,0x20,0xF4,0x63,0xE8,0xC7,
+0xC0,0x74,0x61,0x08,0x45,0xC0,0xF4,0x63,0x18,0xC7,0xC0,0xFC,0x21,0xE8,0x43,0xE0,
+0xFC,0x21,0xE8,0x42,0x00,0x7C,0x61,0x09,0xC5,0xE0,0x8C,0x63,0xF8,0xC6,0x20,0xE9,
+0x24,0xB8,0x38,0x84,0x21,0x49,0x80,0x8C,0xA9,0x8A,0x4A,0x20,0x84,0x21,0x08,0x43,
+0xE0,0x8E,0xEB,0x5A,0xC6,0x20,0x8C,0x73,0x59,0xC6,0x20,0x74,0x63,0x18,0xC5,0xC0,
+0xF4,0x63,0xE8,0x42,0x00,0x74,0x63,0x1A,0xC9,0xA0,0xF4,0x63,0xEA,0x4A,0x20,0x74,
+0x60,0xE0,0xC5,0xC0,0xFD,0x48,0x42,0x10,0x80,0x8C,0x63,0x18,0xC5,0xC0,0x8C,0x63,
+0x18,0xA8,0x80,0x8C,0x63,0x5A,0xD5,0x40,0x8C,0x54,0x45,0x46,0x20,0x8C,0x54,0x42,
+0x10,0x80,0xF8,0x44,0xE4,0x43,0xE0,0xF8,0x88,0x88,0xF0,0x82,0x08,0x20,0x80,0xF1,
+0x11,0x11,0xF0,0x22,0xA2,0xF8,0xD9,0x10,0x60,0x9D,0x27,0x80,0x84,0x2D,0x98,0xE6,
+0xC0,0x74,0x61,0x17,0x00,0x08,0x5B,0x38,0xCD,0xA0,0x74,0x7F,0x07,0x00,0x25,0x4E,
+0x44,0x40,0x74,0xE6,0xD0,0xB8,0x84,0x2D,0x98,0xC6,0x20,0x43,0x24,0xB8,0x10,0x11,
+0x19,0x60,0x88,0x9A,0xCA,0x90,0xC9,0x24,0xB8,0xD5,0x6B,0x5A,0x80,0xB6,0x63,0x18,
+0x80,0x74,0x63,0x17,0x00,0xB6,0x73,0x68,0x40,0x6C,0xE6,0xD0,0x84,0xB6,0x61,0x08,
+0x00,0x7C,0x1C,0x1F,0x00,0x21,0x3E,0x42,0x14,0x40,0x8C,0x63,0x36,0x80,0x8C,0x62,
+0xA2,0x00,0x8C,0x6B,0x55,0x00,0x8A,0x88,0xA8,0x80,0x8C,0x5E,0x18,0xB8,0xF8,0x88,
+0x8F,0x80,0x29,0x44,0x88,0xEE,0x89,0x14,0xA0,0x45,0x44,
+};
+
+static const rvlPropGlyph_t FontDefaultPropGlyphs[95] =
+{
+// offset, width, height, advance, xOffset, yOffset
+	{0, 0, 0, 3, 0, 0},  // space
+	{0, 1, 7, 2, 0, 0},  // !
+	{1, 3, 3, 4, 0, 0},  // "
+	{3, 5, 7, 6, 0, 0},  // #
+	{8, 5, 7, 6, 0, 0},  // $
+	{13, 5, 7, 6, 0, 0},  // %
+	{18, 5, 7, 6, 0, 0},  // &
+	{23, 3, 4, 4, 0, 0},  // '
+	{25, 3, 7, 4, 0, 0},  // (
+	{28, 3, 7, 4, 0, 0},  // )
+	{31, 5, 7, 6, 0, 0},  // *
+	{36, 5, 5, 6, 0, 1},  // +
+	{40, 3, 4, 4, 0, 4},  // ,
+	{42, 5, 1, 6, 0, 3},  // -
+	{43, 2, 2, 3, 0, 5},  // .
+	{44, 5, 5, 6, 0, 1},  // /
+	{48, 5, 7, 6, 0, 0},  // 0
+	{53, 3, 7, 4, 0, 0},  // 1
+	{56, 5, 7, 6, 0, 0},  // 2
+	{61, 5, 7, 6, 0, 0},  // 3
+	{66, 5, 7, 6, 0, 0},  // 4
+	{71, 5, 7, 6, 0, 0},  // 5
+	{76, 5, 7, 6, 0, 0},  // 6
+	{81, 5, 7, 6, 0, 0},  // 7
+	{86, 5, 7, 6, 0, 0},  // 8
+	{91, 5, 7, 6, 0, 0},  // 9
+	{96, 1, 3, 2, 0, 2},  // :
+	{97, 2, 5, 3, 0, 2},  // ;
+	{99, 4, 7, 5, 0, 0},  // <
+	{103, 5, 3, 6, 0, 2},  // =
+	{105, 4, 7, 5, 0, 0},  // >
+	{109, 5, 7, 6, 0, 0},  // ?
+	{114, 5, 7, 6, 0, 0},  // @
+	{119, 5, 7, 6, 0, 0},  // A
+	{124, 5, 7, 6, 0, 0},  // B
+	{129, 5, 7, 6, 0, 0},  // C
+	{134, 5, 7, 6, 0, 0},  // D
+	{139, 5, 7, 6, 0, 0},  // E
+	{144, 5, 7, 6, 0, 0},  // F
+	{149, 5, 7, 6, 0, 0},  // G
+	{154, 5, 7, 6, 0, 0},  // H
+	{159, 3, 7, 4, 0, 0},  // I
+	{162, 5, 7, 6, 0, 0},  // J
+	{167, 5, 7, 6, 0, 0},  // K
+	{172, 5, 7, 6, 0, 0},  // L
+	{177, 5, 7, 6, 0, 0},  // M
+	{182, 5, 7, 6, 0, 0},  // N
+	{187, 5, 7, 6, 0, 0},  // O
+	{192, 5, 7, 6, 0, 0},  // P
+	{197, 5, 7, 6, 0, 0},  // Q
+	{202, 5, 7, 6, 0, 0},  // R
+	{207, 5, 7, 6, 0, 0},  // S
+	{212, 5, 7, 6, 0, 0},  // T
+	{217, 5, 7, 6, 0, 0},  // U
+	{222, 5, 7, 6, 0, 0},  // V
+	{227, 5, 7, 6, 0, 0},  // W
+	{232, 5, 7, 6, 0, 0},  // X
+	{237, 5, 7, 6, 0, 0},  // Y
+	{242, 5, 7, 6, 0, 0},  // Z
+	{247, 4, 7, 5, 0, 0},  // [
+	{251, 5, 5, 6, 0, 1},  // backslash
+	{255, 4, 7, 5, 0, 0},  // ]
+	{259, 5, 3, 6, 0, 0},  // ^
+	{261, 5, 1, 6, 0, 6},  // _
+	{262, 3, 4, 4, 0, 0},  // `
+	{264, 5, 5, 6, 0, 2},  // a
+	{268, 5, 7, 6, 0, 0},  // b
+	{273, 5, 5, 6, 0, 2},  // c
+	{277, 5, 7, 6, 0, 0},  // d
+	{282, 5, 5, 6, 0, 2},  // e
+	{286, 4, 7, 5, 0, 0},  // f
+	{290, 5, 6, 6, 0, 2},  // g
+	{294, 5, 7, 6, 0, 0},  // h
+	{299, 3, 7, 4, 0, 0},  // i
+	{302, 4, 7, 5, 0, 0},  // j
+	{306, 4, 7, 5, 0, 0},  // k
+	{310, 3, 7, 4, 0, 0},  // l
+	{313, 5, 5, 6, 0, 2},  // m
+	{317, 5, 5, 6, 0, 2},  // n
+	{321, 5, 5, 6, 0, 2},  // o
+	{325, 5, 6, 6, 0, 2},  // p
+	{329, 5, 6, 6, 0, 2},  // q
+	{333, 5, 5, 6, 0, 2},  // r
+	{337, 5, 5, 6, 0, 2},  // s
+	{341, 5, 7, 6, 0, 0},  // t
+	{346, 5, 5, 6, 0, 2},  // u
+	{350, 5, 5, 6, 0, 2},  // v
+	{354, 5, 5, 6, 0, 2},  // w
+	{358, 5, 5, 6, 0, 2},  // x
+	{362, 5, 6, 6, 0, 2},  // y
+	{366, 5, 5, 6, 0, 2},  // z
+	{370, 3, 7, 4, 0, 0},  // {
+	{373, 1, 7, 2, 0, 0},  // |
+	{374, 3, 7, 4, 0, 0},  // }
+	{377, 5, 3, 6, 0, 0},  // ~
+};
+
+static const rvlPropFont_t FontDefaultProp =
+{
+	FontDefaultPropBitmap, FontDefaultPropGlyphs, 0x20, 0x7E, 8, 6  // bitmap, glyphs, first, last, height, maxAdvance
+};
+
+/*!
+	Font type: Proportional font (95 chars)
+	Proportional version of the ArialBold font, 16 pixels high, glyphs trimmed to their ink
+	Memory usage : 996 bytes bitmap, 95 glyphs
+*/
+static const uint8_t FontArialBoldPropBitmap[996] =
+{
+0xFF,0xFF,0xCF,0xCF,0x3C,0xF3,0x0D,0x83,0x61,0xB3,0xFF,0xFF,0xC6,0xC3,0x63,0xFF,
+0xFF,0xCD,0x86,0xC1,0xB0,0x10,0x71,0xF6,0xBD,0x1E,0x1E,0x1E,0x1F,0xAF,0x5B,0xE3,
+0x82,0x00,0x78,0x31,0x98,0xC3,0x31,0x86,0x66,0x0C,0xD8,0x0F,0x30,0x00,0xCF,0x01,
+0xB3,0x06,0x66,0x0C,0xCC,0x31,0x98,0xC1,0xE0,0x3E,0x0F,0xE1,0x8C,0x31,0x83,0xE0,
+0x78,0x1B,0x26,0x76,0xC7,0x98,0x79,0xFF,0x9E,0x20,0xFF,0x36,0x6C,0xCC,0xCC,0xCC,
+0x66,0x30,0xC6,0x63,0x33,0x33,0x33,0x66,0xC0,0x0E,0x01,0xC3,0x39,0xFF,0xF1,0xF0,
+0x3E,0x0E,0xE3,0x8E,0x11,0x00,0x18,0x18,0x18,0xFF,0xFF,0x18,0x18,0x18,0xF5,0x80,
+0xFF,0xC0,0xF0,0x18,0xCC,0x63,0x19,0x8C,0x63,0x31,0x80,0x3C,0x7E,0xE7,0xC3,0xC3,
+0xC3,0xC3,0xC3,0xC3,0xE7,0x7E,0x3C,0x19,0xDF,0xB9,0x8C,0x63,0x18,0xC6,0x30,0x3C,
+0x7E,0xE3,0xC3,0x03,0x06,0x0E,0x1C,0x38,0x60,0xFF,0xFF,0x3E,0x7F,0xE3,0x03,0x1E,
+0x1E,0x07,0x03,0xC3,0xE7,0x7E,0x3C,0x06,0x0E,0x0E,0x1E,0x36,0x36,0x66,0xC6,0xFF,
+0xFF,0x06,0x06,0x7E,0x7E,0x60,0xC0,0xFC,0xFE,0xC7,0x03,0xC3,0xE7,0x7E,0x3C,0x3E,
+0x7F,0x63,0xC0,0xDC,0xFE,0xE7,0xC3,0xC3,0x63,0x7E,0x3C,0xFF,0xFF,0x06,0x0C,0x0C,
+0x18,0x18,0x18,0x38,0x30,0x30,0x30,0x3C,0x7E,0xC3,0xC3,0xC3,0x7E,0x7E,0xC3,0xC3,
+0xC3,0x7E,0x3C,0x3C,0x7E,0xC6,0xC3,0xC3,0xE7,0x7F,0x3B,0x03,0xC6,0xFE,0x7C,0xF0,
+0x03,0xC0,0xF0,0x03,0xD6,0x01,0x07,0x1E,0x78,0xE0,0x78,0x1E,0x07,0x01,0xFF,0xFF,
+0xC0,0x00,0x0F,0xFF,0xFC,0x80,0xE0,0x78,0x1E,0x07,0x1E,0x78,0xE0,0x80,0x3C,0x7E,
+0xE3,0xC3,0x07,0x0E,0x1C,0x18,0x18,0x00,0x18,0x18,0x1F,0x06,0x19,0x37,0xAF,0xDB,
+0x33,0x66,0x6C,0xCD,0xFA,0x9B,0x88,0x04,0x81,0x0F,0xC0,0x0E,0x01,0xC0,0x6C,0x0D,
+0x81,0xB0,0x63,0x0C,0x61,0xFC,0x7F,0xCC,0x19,0x83,0x60,0x30,0xFF,0x3F,0xEC,0x1B,
+0x06,0xC1,0xBF,0xCF,0xFB,0x03,0xC0,0xF0,0x3F,0xFB,0xFC,0x1F,0x1F,0xE6,0x1F,0x82,
+0xC0,0x30,0x0C,0x03,0x00,0xE0,0x98,0x77,0xF8,0x7C,0xFE,0x3F,0xEC,0x1B,0x03,0xC0,
+0xF0,0x3C,0x0F,0x03,0xC0,0xF0,0x6F,0xFB,0xF8,0xFF,0xFF,0xF0,0x18,0x0C,0x07,0xFF,
+0xFF,0x80,0xC0,0x60,0x3F,0xFF,0xF0,0xFF,0xFF,0xC0,0xC0,0xC0,0xFE,0xFE,0xC0,0xC0,
+0xC0,0xC0,0xC0,0x1F,0x8F,0xF9,0x83,0xF0,0x2C,0x01,0x80,0x30,0xFE,0x1F,0xE0,0x6C,
+0x1D,0xFF,0x8F,0xC0,0xC0,0xF0,0x3C,0x0F,0x03,0xC0,0xFF,0xFF,0xFF,0x03,0xC0,0xF0,
+0x3C,0x0F,0x03,0xFF,0xFF,0xFF,0x03,0x03,0x03,0x03,0x03,0x03,0x03,0x03,0xC3,0xE7,
+0x7E,0x3C,0xC0,0xF0,0x6C,0x33,0x18,0xCC,0x37,0x8F,0x63,0x8C,0xC3,0xB0,0x6C,0x0F,
+0x03,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xFF,0xFF,0xE0,0xFC,0x1F,
+0xC7,0xF8,0xFD,0x17,0xB6,0xF6,0xDE,0xDB,0xCE,0x79,0xCF,0x39,0xE2,0x30,0xC0,0xF8,
+0x3F,0x0F,0xC3,0xD8,0xF3,0x3C,0xCF,0x1B,0xC3,0xF0,0xFC,0x1F,0x03,0x1F,0x0F,0xF9,
+0x83,0x60,0x3C,0x07,0x80,0xF0,0x1E,0x03,0xC0,0x6C,0x19,0xFF,0x0F,0x80,0xFE,0x7F,
+0xB0,0xF8,0x3C,0x3F,0xFB,0xF9,0x80,0xC0,0x60,0x30,0x18,0x00,0x1F,0x0F,0xF9,0x83,
+0x60,0x3C,0x07,0x80,0xF0,0x1E,0x03,0xC6,0xEC,0x79,0xFF,0x0F,0x60,0x06,0xFF,0x1F,
+0xF3,0x07,0x60,0x6C,0x1D,0xFF,0x3F,0x86,0x38,0xC3,0x98,0x33,0x07,0x60,0x70,0x3E,
+0x3F,0xB8,0xF8,0x3F,0x03,0xF0,0x7C,0x07,0xC1,0xF1,0xDF,0xC7,0xC0,0xFF,0xFF,0xF0,
+0xC0,0x30,0x0C,0x03,0x00,0xC0,0x30,0x0C,0x03,0x00,0xC0,0x30,0xC0,0xF0,0x3C,0x0F,
+0x03,0xC0,0xF0,0x3C,0x0F,0x03,0xC0,0xF8,0x77,0xF8,0xFC,0xC0,0x6C,0x19,0x83,0x30,
+0x63,0x18,0x63,0x0E,0xE0,0xD8,0x1B,0x01,0xC0,0x38,0x07,0x00,0xC7,0x1E,0x38,0xF1,
+0xC6,0xDB,0x66,0xDB,0x36,0xD9,0xB6,0xCD,0xB6,0x38,0xE1,0xC7,0x0E,0x38,0x71,0xC0,
+0xC1,0xF1,0xD8,0xC6,0xC3,0xE0,0xE0,0x70,0x7C,0x36,0x31,0xB8,0xF8,0x30,0xC0,0xF8,
+0x76,0x18,0xCC,0x33,0x07,0x80,0xC0,0x30,0x0C,0x03,0x00,0xC0,0x30,0x7F,0xBF,0xC0,
+0xC0,0xC0,0xE0,0x60,0x60,0x70,0x30,0x30,0x3F,0xFF,0xF0,0xFF,0xCC,0xCC,0xCC,0xCC,
+0xCC,0xFF,0xC6,0x18,0xC6,0x30,0xC6,0x31,0x86,0x30,0xFF,0x33,0x33,0x33,0x33,0x33,
+0xFF,0x18,0x3C,0x3C,0x66,0x66,0x66,0xC3,0xFF,0xFF,0xFF,0xFF,0xCC,0x7C,0xFE,0xC6,
+0x1E,0x7E,0xE6,0xC6,0xFE,0x7B,0xC0,0xC0,0xC0,0xDC,0xFE,0xE7,0xC3,0xC3,0xC3,0xE7,
+0xFE,0xDC,0x3C,0xFF,0x9E,0x0C,0x18,0x39,0xBF,0x3C,0x03,0x03,0x03,0x3B,0x7F,0xE7,
+0xC3,0xC3,0xC3,0xE7,0x7F,0x3B,0x38,0xFB,0x1F,0xFF,0xF8,0x39,0xBE,0x38,0x3D,0xF6,
+0x3E,0xF9,0x86,0x18,0x61,0x86,0x18,0x3B,0x7F,0xE7,0xC3,0xC3,0xC3,0xE7,0x7F,0x3B,
+0xC3,0xFF,0x7E,0xC0,0xC0,0xC0,0xDE,0xFF,0xE3,0xC3,0xC3,0xC3,0xC3,0xC3,0xC3,0xF3,
+0xFF,0xFC,0x33,0x03,0x33,0x33,0x33,0x33,0xFE,0xC1,0x83,0x06,0x3C,0xDB,0x3E,0x7E,
+0xED,0x9B,0x1E,0x30,0xFF,0xFF,0xFF,0xDC,0xEF,0xFF,0xE7,0x3C,0x63,0xC6,0x3C,0x63,
+0xC6,0x3C,0x63,0xC6,0x30,0xDE,0xFF,0xE3,0xC3,0xC3,0xC3,0xC3,0xC3,0xC3,0x3C,0x7E,
+0xE7,0xC3,0xC3,0xC3,0xE7,0x7E,0x3C,0xDC,0xFE,0xE7,0xC3,0xC3,0xC3,0xE7,0xFE,0xDC,
+0xC0,0xC0,0xC0,0x3B,0x7F,0xE7,0xC3,0xC3,0xC3,0xE7,0x7F,0x3B,0x03,0x03,0x03,0xDF,
+0xFE,0x30,0xC3,0x0C,0x30,0xC0,0x7D,0xFF,0x1F,0x87,0xC1,0xF1,0xFF,0x7C,0x23,0x19,
+0xFF,0xB1,0x8C,0x63,0x1E,0x70,0xC3,0xC3,0xC3,0xC3,0xC3,0xC3,0xC7,0xFF,0x7B,0xC7,
+0x8F,0x1B,0x66,0xCD,0x8E,0x1C,0x38,0xC7,0x1E,0x38,0xD9,0xCC,0xDB,0x66,0xDB,0x36,
+0xD8,0xE3,0x87,0x1C,0x38,0xE0,0xC7,0xDD,0xB1,0xC3,0x87,0x1B,0x77,0xC6,0xC1,0xE0,
+0xD8,0xCC,0x63,0x61,0xB0,0xF8,0x38,0x1C,0x0C,0x1E,0x0E,0x00,0xFF,0xFC,0x30,0xE3,
+0x8E,0x18,0x7F,0xFE,0x1C,0xF3,0x0C,0x30,0xCE,0x38,0x30,0xC3,0x0C,0x30,0xF1,0xC0,
+0xFF,0xFF,0xFF,0xFF,0xE3,0xC3,0x0C,0x30,0xC1,0xC7,0x30,0xC3,0x0C,0x33,0xCE,0x00,
+0x78,0xFF,0xE3,0xC0,
+};
+
+static const rvlPropGlyph_t FontArialBoldPropGlyphs[95] =
+{
+// offset, width, height, advance, xOffset, yOffset
+	{0, 0, 0, 6, 0, 0},  // space
+	{0, 2, 12, 4, 0, 2},  // !
+	{3, 6, 4, 8, 0, 2},  // "
+	{6, 10, 12, 12, 0, 2},  // #
+	{21, 7, 14, 9, 0, 1},  // $
+	{34, 15, 12, 17, 0, 2},  // %
+	{57, 11, 12, 13, 0, 2},  // &
+	{74, 2, 4, 4, 0, 2},  // '
+	{75, 4, 13, 6, 0, 1},  // (
+	{82, 4, 13, 6, 0, 1},  // )
+	{89, 11, 9, 13, 0, 4},  // *
+	{102, 8, 8, 10, 0, 5},  // +
+	{110, 2, 5, 4, 0, 10},  // ,
+	{112, 5, 2, 7, 0, 8},  // -
+	{114, 2, 2, 4, 0, 11},  // .
+	{115, 5, 12, 7, 0, 2},  // /
+	{123, 8, 12, 10, 0, 2},  // 0
+	{135, 5, 12, 7, 0, 2},  // 1
+	{143, 8, 12, 10, 0, 2},  // 2
+	{155, 8, 12, 10, 0, 2},  // 3
+	{167, 8, 12, 10, 0, 2},  // 4
+	{179, 8, 12, 10, 0, 2},  // 5
+	{191, 8, 12, 10, 0, 2},  // 6
+	{203, 8, 12, 10, 0, 2},  // 7
+	{215, 8, 12, 10, 0, 2},  // 8
+	{227, 8, 12, 10, 0, 2},  // 9
+	{239, 2, 9, 4, 0, 3},  // :
+	{242, 2, 12, 4, 0, 3},  // ;
+	{245, 8, 9, 10, 0, 4},  // <
+	{254, 9, 6, 11, 0, 4},  // =
+	{261, 8, 9, 10, 0, 4},  // >
+	{270, 8, 12, 10, 0, 2},  // ?
+	{282, 11, 12, 13, 0, 1},  // @
+	{299, 11, 12, 13, 0, 2},  // A
+	{316, 10, 12, 12, 0, 2},  // B
+	{331, 10, 12, 12, 0, 2},  // C
+	{346, 10, 12, 12, 0, 2},  // D
+	{361, 9, 12, 11, 0, 2},  // E
+	{375, 8, 12, 10, 0, 2},  // F
+	{387, 11, 12, 13, 0, 2},  // G
+	{404, 10, 12, 12, 0, 2},  // H
+	{419, 2, 12, 4, 0, 2},  // I
+	{422, 8, 12, 10, 0, 2},  // J
+	{434, 10, 12, 12, 0, 2},  // K
+	{449, 8, 12, 10, 0, 2},  // L
+	{461, 11, 12, 13, 0, 2},  // M
+	{478, 10, 12, 12, 0, 2},  // N
+	{493, 11, 12, 13, 0, 2},  // O
+	{510, 9, 12, 11, 0, 2},  // P
+	{524, 11, 13, 13, 0, 2},  // Q
+	{542, 11, 12, 13, 0, 2},  // R
+	{559, 9, 12, 11, 0, 2},  // S
+	{573, 10, 12, 12, 0, 2},  // T
+	{588, 10, 12, 12, 0, 2},  // U
+	{603, 11, 12, 13, 0, 2},  // V
+	{620, 13, 12, 15, 0, 2},  // W
+	{640, 9, 12, 11, 0, 2},  // X
+	{654, 10, 12, 12, 0, 2},  // Y
+	{669, 9, 12, 11, 0, 2},  // Z
+	{683, 4, 14, 6, 0, 1},  // [
+	{690, 5, 12, 7, 0, 2},  // backslash
+	{698, 4, 14, 6, 0, 1},  // ]
+	{705, 8, 7, 10, 0, 1},  // ^
+	{712, 16, 2, 18, 0, 13},  // _
+	{716, 3, 2, 5, 0, 2},  // `
+	{717, 8, 9, 10, 0, 4},  // a
+	{726, 8, 12, 10, 0, 1},  // b
+	{738, 7, 9, 9, 0, 4},  // c
+	{746, 8, 12, 10, 0, 1},  // d
+	{758, 7, 9, 9, 0, 4},  // e
+	{766, 6, 12, 8, 0, 1},  // f
+	{775, 8, 12, 10, 0, 3},  // g
+	{787, 8, 12, 10, 0, 1},  // h
+	{799, 2, 11, 4, 0, 2},  // i
+	{802, 4, 14, 6, 0, 2},  // j
+	{809, 7, 12, 9, 0, 1},  // k
+	{820, 2, 12, 4, 0, 1},  // l
+	{823, 12, 9, 14, 0, 4},  // m
+	{837, 8, 9, 10, 0, 4},  // n
+	{846, 8, 9, 10, 0, 4},  // o
+	{855, 8, 12, 10, 0, 4},  // p
+	{867, 8, 12, 10, 0, 4},  // q
+	{879, 6, 9, 8, 0, 4},  // r
+	{886, 7, 9, 9, 0, 4},  // s
+	{894, 5, 12, 7, 0, 1},  // t
+	{902, 8, 9, 10, 0, 4},  // u
+	{911, 7, 9, 9, 0, 4},  // v
+	{919, 13, 9, 15, 0, 4},  // w
+	{934, 7, 9, 9, 0, 4},  // x
+	{942, 9, 12, 11, 0, 4},  // y
+	{956, 7, 9, 9, 0, 4},  // z
+	{964, 6, 15, 8, 0, 0},  // {
+	{976, 2, 16, 4, 0, 0},  // |
+	{980, 6, 15, 8, 0, 0},  // }
+	{992, 9, 3, 11, 0, 2},  // ~
+};
+
+static const rvlPropFont_t FontArialBoldProp =
+{
+	FontArialBoldPropBitmap, FontArialBoldPropGlyphs, 0x20, 0x7E, 16, 18  // bitmap, glyphs, first, last, height, maxAdvance
+};
+
+// The compile time geometry in rvlFontInfo must match each font's header
+static constexpr bool fontInfoMatches(const uint8_t* pFont, display_Font_name_e font)
+{
+	const rvlFontInfo_t& info = rvlFontInfo[font - 1];
+	return pFont[0] == info.width && pFont[1] == info.height && pFont[2] == info.offset && pFont[3] == info.numChars;
+}
+static_assert(fontInfoMatches(FontDefault, font_default), "FontDefault header differs from rvlFontInfo");
+static_assert(fontInfoMatches(FontPICO, font_pico), "FontPICO header differs from rvlFontInfo");
+static_assert(fontInfoMatches(FontSevenSeg, font_sevenSeg), "FontSevenSeg header differs from rvlFontInfo");
+static_assert(fontInfoMatches(FontThick, font_thick), "FontThick header differs from rvlFontInfo");
+static_assert(fontInfoMatches(FontWide, font_wide), "FontWide header differs from rvlFontInfo");
+static_assert(fontInfoMatches(FontSinclairS, font_sinclairS), "FontSinclairS header differs from rvlFontInfo");
+static_assert(fontInfoMatches(FontRetro, font_retro), "FontRetro header differs from rvlFontInfo");
+static_assert(fontInfoMatches(FontMEGA, font_mega), "FontMEGA header differs from rvlFontInfo");
+static_assert(fontInfoMatches(FontArialBold, font_arialBold), "FontArialBold header differs from rvlFontInfo");
+static_assert(fontInfoMatches(FontHallfetica, font_hallfetica), "FontHallfetica header differs from rvlFontInfo");
+static_assert(fontInfoMatches(FontOrla, font_orla), "FontOrla header differs from rvlFontInfo");
+static_assert(fontInfoMatches(FontArialRound, font_arialRound), "FontArialRound header differs from rvlFontInfo");
+static_assert(fontInfoMatches(FontGrotesk, font_groTesk), "FontGrotesk header differs from rvlFontInfo");
+static_assert(fontInfoMatches(FontMint, font_mint), "FontMint header differs from rvlFontInfo");
+static_assert(fontInfoMatches(FontSixteenSeg, font_sixteenSeg), "FontSixteenSeg header differs from rvlFontInfo");
+
 const uint8_t * pFontDefault = FontDefault;
 const uint8_t * pFontPico = FontPICO;
 const uint8_t * pFontSevenSeg = FontSevenSeg;
@@ -1554,5 +2080,7 @@ const uint8_t * pFontArialRound = FontArialRound;
 const uint8_t * pFontGroTesk = FontGrotesk;
 const uint8_t * pFontMint = FontMint;
 const uint8_t * pFontSixteenSeg = FontSixteenSeg;
+const rvlPropFont_t * pFontDefaultProp = &FontDefaultProp;
+const rvlPropFont_t * pFontArialBoldProp = &FontArialBoldProp;
 
 // === End of Font Data ===
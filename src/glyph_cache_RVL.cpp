@@ -0,0 +1,144 @@
+/*!
+	@file     glyph_cache_RVL.cpp
+	@author   Gavin Lyons
+	@brief    LRU cache of rendered font glyphs in display format, with a byte budget.
+				Project Name: ST7789_TFT_RPI
+*/
+
+#include <iterator>
+#include "../include/glyph_cache_RVL.hpp"
+
+/*!
+	@brief Constructor
+	@param budgetBytes maximum bytes of glyph data held, a glyph takes font width * height * 2
+*/
+glyphCache::glyphCache(size_t budgetBytes)
+{
+	_stats.budgetBytes = budgetBytes;
+}
+
+/*!
+	@brief Look up a glyph, counts a hit or a miss
+	@param key font, character, colors and inversion of the glyph
+	@return the rendered glyph, now most recently used, or nullptr on a miss
+*/
+const uint8_t* glyphCache::find(const rvlGlyphCache_Key_t& key)
+{
+	auto found = _index.find(key);
+	if (found == _index.end())
+	{
+		_stats.misses++;
+		return nullptr;
+	}
+	_stats.hits++;
+	_lru.splice(_lru.begin(), _lru, found->second);
+	return found->second->data.data();
+}
+
+/*!
+	@brief Make space for a new glyph, the caller renders into it
+	@param key font, character, colors and inversion of the glyph
+	@param bytes size of the rendered glyph
+	@return buffer of bytes to render the glyph to,
+		or nullptr if the glyph is larger than the whole budget
+	@note Least recently used glyphs are evicted until the new one fits.
+*/
+uint8_t* glyphCache::insert(const rvlGlyphCache_Key_t& key, size_t bytes)
+{
+	if (bytes > _stats.budgetBytes) return nullptr;
+	auto found = _index.find(key);
+	if (found != _index.end()) eraseEntry(found->second);
+	evictTo(_stats.budgetBytes - bytes);
+
+	_lru.emplace_front();
+	Entry& entry = _lru.front();
+	entry.key = key;
+	entry.data.resize(bytes);
+	_index[key] = _lru.begin();
+	_stats.bytesUsed += bytes;
+	_stats.entries++;
+	return entry.data.data();
+}
+
+/*!
+	@brief Remove every glyph rendered from a font
+	@param font font data pointer, fixed font bytes or rvlPropFont_t
+	@note Only needed if the font data itself is changed, glyphs of other
+		fonts and colors are never served for the current ones.
+*/
+void glyphCache::invalidate(const void* font)
+{
+	for (auto it = _lru.begin(); it != _lru.end(); )
+	{
+		auto next = std::next(it);
+		if (it->key.font == font) eraseEntry(it);
+		it = next;
+	}
+}
+
+/*!
+	@brief Remove all glyphs, counters are kept
+*/
+void glyphCache::clear(void)
+{
+	_lru.clear();
+	_index.clear();
+	_stats.bytesUsed = 0;
+	_stats.entries = 0;
+}
+
+/*!
+	@brief Change the budget, evicting glyphs if now over it
+	@param budgetBytes maximum bytes of glyph data held
+*/
+void glyphCache::setBudget(size_t budgetBytes)
+{
+	_stats.budgetBytes = budgetBytes;
+	evictTo(budgetBytes);
+}
+
+/*!
+	@brief Get cache counters
+	@return hits, misses, evictions, entries, bytes used and budget
+*/
+rvlGlyphCache_Stats_t glyphCache::getStats(void) const
+{
+	return _stats;
+}
+
+/*!
+	@brief Zero the hit, miss and eviction counters
+*/
+void glyphCache::resetStats(void)
+{
+	_stats.hits = 0;
+	_stats.misses = 0;
+	_stats.evictions = 0;
+}
+
+/*!
+	@brief Evict least recently used glyphs until bytes used is at most budgetBytes
+	@param budgetBytes target bytes used
+*/
+void glyphCache::evictTo(size_t budgetBytes)
+{
+	while (_stats.bytesUsed > budgetBytes && !_lru.empty())
+	{
+		eraseEntry(std::prev(_lru.end()));
+		_stats.evictions++;
+	}
+}
+
+/*!
+	@brief Remove a glyph from list and index
+	@param it list position of the glyph
+*/
+void glyphCache::eraseEntry(std::list<Entry>::iterator it)
+{
+	_stats.bytesUsed -= it->data.size();
+	_stats.entries--;
+	_index.erase(it->key);
+	_lru.erase(it);
+}
+
+// **************** EOF *****************
@@ -0,0 +1,157 @@
+/*!
+	@file     image_cache_RVL.cpp
+	@author   Gavin Lyons
+	@brief    LRU cache of images converted to display format, with a byte budget.
+				Project Name: ST7789_TFT_RPI
+*/
+
+#include <iterator>
+#include "../include/image_cache_RVL.hpp"
+
+/*!
+	@brief Constructor
+	@param budgetBytes maximum bytes of image data held, an image takes width * height * 2
+*/
+imageCache::imageCache(size_t budgetBytes)
+{
+	_stats.budgetBytes = budgetBytes;
+}
+
+/*!
+	@brief Look up an image, counts a hit or a miss
+	@param key source of the image
+	@return the cached image, now most recently used, or nullptr on a miss
+*/
+const rvlCachedImage_t* imageCache::find(const rvlImageCache_Key_t& key)
+{
+	auto found = _index.find(key);
+	if (found == _index.end())
+	{
+		_stats.misses++;
+		return nullptr;
+	}
+	_stats.hits++;
+	_lru.splice(_lru.begin(), _lru, found->second);
+	return &found->second->image;
+}
+
+/*!
+	@brief Make space for a new image, the caller fills in the data
+	@param key source of the image
+	@param width width in pixels
+	@param height height in pixels
+	@return buffer of width * height * 2 bytes to write the converted image to,
+		or nullptr if the image is larger than the whole budget
+	@note Least recently used images are evicted until the new one fits.
+		If the caller cannot fill the buffer it must call erase(key).
+*/
+uint8_t* imageCache::insert(const rvlImageCache_Key_t& key, uint16_t width, uint16_t height)
+{
+	size_t bytes = (size_t)width * height * 2;
+	if (bytes > _stats.budgetBytes) return nullptr;
+	erase(key);
+	evictTo(_stats.budgetBytes - bytes);
+
+	_lru.emplace_front();
+	Entry& entry = _lru.front();
+	entry.key = key;
+	entry.image.width = width;
+	entry.image.height = height;
+	entry.image.data.resize(bytes);
+	_index[key] = _lru.begin();
+	_stats.bytesUsed += bytes;
+	_stats.entries++;
+	return entry.image.data.data();
+}
+
+/*!
+	@brief Remove one image if present, not counted as an eviction
+	@param key source of the image
+*/
+void imageCache::erase(const rvlImageCache_Key_t& key)
+{
+	auto found = _index.find(key);
+	if (found != _index.end()) eraseEntry(found->second);
+}
+
+/*!
+	@brief Remove every image converted from a source pointer
+	@param source pointer passed to drawBitmap24 / drawBitmap16
+	@note Call after changing the data at source, the cache can not see that.
+*/
+void imageCache::invalidate(const void* source)
+{
+	for (auto it = _lru.begin(); it != _lru.end(); )
+	{
+		auto next = std::next(it);
+		if (it->key.source == source) eraseEntry(it);
+		it = next;
+	}
+}
+
+/*!
+	@brief Remove all images, counters are kept
+*/
+void imageCache::clear(void)
+{
+	_lru.clear();
+	_index.clear();
+	_stats.bytesUsed = 0;
+	_stats.entries = 0;
+}
+
+/*!
+	@brief Change the budget, evicting images if now over it
+	@param budgetBytes maximum bytes of image data held
+*/
+void imageCache::setBudget(size_t budgetBytes)
+{
+	_stats.budgetBytes = budgetBytes;
+	evictTo(budgetBytes);
+}
+
+/*!
+	@brief Get cache counters
+	@return hits, misses, evictions, entries, bytes used and budget
+*/
+rvlImageCache_Stats_t imageCache::getStats(void) const
+{
+	return _stats;
+}
+
+/*!
+	@brief Zero the hit, miss and eviction counters
+*/
+void imageCache::resetStats(void)
+{
+	_stats.hits = 0;
+	_stats.misses = 0;
+	_stats.evictions = 0;
+}
+
+/*!
+	@brief Evict least recently used images until bytes used is at most budgetBytes
+	@param budgetBytes target bytes used
+*/
+void imageCache::evictTo(size_t budgetBytes)
+{
+	while (_stats.bytesUsed > budgetBytes && !_lru.empty())
+	{
+		eraseEntry(std::prev(_lru.end()));
+		_stats.evictions++;
+	}
+}
+
+/*!
+	@brief Remove an image from list and index
+	@param it list position of the image
+*/
+void imageCache::eraseEntry(std::list<Entry>::iterator it)
+{
+	_stats.bytesUsed -= it->image.data.size();
+	_stats.entries--;
+	_index.erase(it->key);
+	_lru.erase(it);
+}
+
+// **************** EOF *****************
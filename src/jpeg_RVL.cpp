@@ -0,0 +1,926 @@
+/*!
+	@file     jpeg_RVL.cpp
+	@author   Gavin Lyons
+	@brief    Baseline JPEG decoder, streams one MCU row at a time as RGB565.
+				Project Name: ST7789_TFT_RPI
+*/
+
+#include <iostream>
+#include <cstring>
+#include "../include/jpeg_RVL.hpp"
+
+// Markers
+#define JPEG_SOI  0xD8 /**< Start of image */
+#define JPEG_EOI  0xD9 /**< End of image */
+#define JPEG_SOF0 0xC0 /**< Baseline frame */
+#define JPEG_SOF1 0xC1 /**< Extended sequential Huffman frame */
+#define JPEG_DHT  0xC4 /**< Huffman tables */
+#define JPEG_DQT  0xDB /**< Quantisation tables */
+#define JPEG_DRI  0xDD /**< Restart interval */
+#define JPEG_SOS  0xDA /**< Start of scan */
+#define JPEG_RST0 0xD0 /**< First restart marker */
+#define JPEG_RST7 0xD7 /**< Last restart marker */
+
+// Integer inverse DCT, Loeffler Ligtenberg Moschytz, 13 bit constants
+#define IDCT_CONST_BITS 13
+#define IDCT_PASS1_BITS 2
+#define FIX_0_298631336 2446
+#define FIX_0_390180644 3196
+#define FIX_0_541196100 4433
+#define FIX_0_765366865 6270
+#define FIX_0_899976223 7373
+#define FIX_1_175875602 9633
+#define FIX_1_501321110 12299
+#define FIX_1_847759065 15137
+#define FIX_1_961570560 16069
+#define FIX_2_053119869 16819
+#define FIX_2_562915447 20995
+#define FIX_3_072711026 25172
+// Largest dequantised coefficient, 8 bit samples give at most 1024 plus half
+// a quantiser step, and steps are at most 255, see readDQT. Clamping here
+// keeps every IDCT product inside 32 bits for any input, a corrupt file only
+// gives a wrong block.
+#define IDCT_COEF_MAX 1152
+// Largest DC predictor, 11 bit DC differences of an 8 bit image
+#define JPEG_DC_MAX 2047
+
+/*! Natural (row major) index of each zig-zag coefficient */
+static const uint8_t ZigZag[64] = {
+	 0,  1,  8, 16,  9,  2,  3, 10, 17, 24, 32, 25, 18, 11,  4,  5,
+	12, 19, 26, 33, 40, 48, 41, 34, 27, 20, 13,  6,  7, 14, 21, 28,
+	35, 42, 49, 56, 57, 50, 43, 36, 29, 22, 15, 23, 30, 37, 44, 51,
+	58, 59, 52, 45, 38, 31, 39, 46, 53, 60, 61, 54, 47, 55, 62, 63
+};
+
+static inline uint8_t ClampSample(int32_t v)
+{
+	return (v < 0) ? 0 : (v > 255) ? 255 : (uint8_t)v;
+}
+
+static inline int32_t Descale(int32_t v, uint8_t n)
+{
+	return (v + (1 << (n - 1))) >> n;
+}
+
+/*!
+	@brief Dequantise a coefficient, clamped to the range the IDCT is safe for
+	@param v quantised coefficient, at most 16 bits
+	@param q quantiser step
+	@return v * q limited to +/- IDCT_COEF_MAX
+*/
+static inline int32_t Dequantise(int32_t v, uint16_t q)
+{
+	if (v > IDCT_COEF_MAX) v = IDCT_COEF_MAX;
+	else if (v < -IDCT_COEF_MAX) v = -IDCT_COEF_MAX;
+	v *= q;
+	return (v > IDCT_COEF_MAX) ? IDCT_COEF_MAX : (v < -IDCT_COEF_MAX) ? -IDCT_COEF_MAX : v;
+}
+
+/*!
+	@brief Full size 8x8 inverse DCT, columns then rows
+	@param pCoef dequantised coefficients, natural order, within +/- IDCT_COEF_MAX
+	@param pOut top left output sample
+	@param stride bytes between output rows
+*/
+static void IDCT8x8(const int32_t* pCoef, uint8_t* pOut, uint8_t stride)
+{
+	int32_t work[64];
+	for (uint8_t col = 0; col < 8; col++)
+	{
+		const int32_t* in = pCoef + col;
+		int32_t* ws = work + col;
+		if (in[8] == 0 && in[16] == 0 && in[24] == 0 && in[32] == 0 &&
+			in[40] == 0 && in[48] == 0 && in[56] == 0)
+		{
+			int32_t dc = in[0] << IDCT_PASS1_BITS;
+			for (uint8_t r = 0; r < 8; r++) ws[r * 8] = dc;
+			continue;
+		}
+		int32_t z2 = in[16], z3 = in[48];
+		int32_t z1 = (z2 + z3) * FIX_0_541196100;
+		int32_t tmp2 = z1 - z3 * FIX_1_847759065;
+		int32_t tmp3 = z1 + z2 * FIX_0_765366865;
+		z2 = in[0];
+		z3 = in[32];
+		int32_t tmp0 = (z2 + z3) << IDCT_CONST_BITS;
+		int32_t tmp1 = (z2 - z3) << IDCT_CONST_BITS;
+		int32_t tmp10 = tmp0 + tmp3, tmp13 = tmp0 - tmp3;
+		int32_t tmp11 = tmp1 + tmp2, tmp12 = tmp1 - tmp2;
+
+		tmp0 = in[56];
+		tmp1 = in[40];
+		tmp2 = in[24];
+		tmp3 = in[8];
+		z1 = tmp0 + tmp3;
+		z2 = tmp1 + tmp2;
+		z3 = tmp0 + tmp2;
+		int32_t z4 = tmp1 + tmp3;
+		int32_t z5 = (z3 + z4) * FIX_1_175875602;
+		tmp0 *= FIX_0_298631336;
+		tmp1 *= FIX_2_053119869;
+		tmp2 *= FIX_3_072711026;
+		tmp3 *= FIX_1_501321110;
+		z1 *= -FIX_0_899976223;
+		z2 *= -FIX_2_562915447;
+		z3 = z3 * -FIX_1_961570560 + z5;
+		z4 = z4 * -FIX_0_390180644 + z5;
+		tmp0 += z1 + z3;
+		tmp1 += z2 + z4;
+		tmp2 += z2 + z3;
+		tmp3 += z1 + z4;
+
+		const uint8_t shift = IDCT_CONST_BITS - IDCT_PASS1_BITS;
+		ws[0]  = Descale(tmp10 + tmp3, shift);
+		ws[56] = Descale(tmp10 - tmp3, shift);
+		ws[8]  = Descale(tmp11 + tmp2, shift);
+		ws[48] = Descale(tmp11 - tmp2, shift);
+		ws[16] = Descale(tmp12 + tmp1, shift);
+		ws[40] = Descale(tmp12 - tmp1, shift);
+		ws[24] = Descale(tmp13 + tmp0, shift);
+		ws[32] = Descale(tmp13 - tmp0, shift);
+	}
+	for (uint8_t row = 0; row < 8; row++)
+	{
+		const int32_t* in = work + row * 8;
+		uint8_t* out = pOut + row * stride;
+		const uint8_t shift = IDCT_CONST_BITS + IDCT_PASS1_BITS + 3;
+		if (in[1] == 0 && in[2] == 0 && in[3] == 0 && in[4] == 0 &&
+			in[5] == 0 && in[6] == 0 && in[7] == 0)
+		{
+			uint8_t dc = ClampSample(Descale(in[0], IDCT_PASS1_BITS + 3) + 128);
+			memset(out, dc, 8);
+			continue;
+		}
+		int32_t z2 = in[2], z3 = in[6];
+		int32_t z1 = (z2 + z3) * FIX_0_541196100;
+		int32_t tmp2 = z1 - z3 * FIX_1_847759065;
+		int32_t tmp3 = z1 + z2 * FIX_0_765366865;
+		int32_t tmp0 = (in[0] + in[4]) << IDCT_CONST_BITS;
+		int32_t tmp1 = (in[0] - in[4]) << IDCT_CONST_BITS;
+		int32_t tmp10 = tmp0 + tmp3, tmp13 = tmp0 - tmp3;
+		int32_t tmp11 = tmp1 + tmp2, tmp12 = tmp1 - tmp2;
+
+		tmp0 = in[7];
+		tmp1 = in[5];
+		tmp2 = in[3];
+		tmp3 = in[1];
+		z1 = tmp0 + tmp3;
+		z2 = tmp1 + tmp2;
+		z3 = tmp0 + tmp2;
+		int32_t z4 = tmp1 + tmp3;
+		int32_t z5 = (z3 + z4) * FIX_1_175875602;
+		tmp0 *= FIX_0_298631336;
+		tmp1 *= FIX_2_053119869;
+		tmp2 *= FIX_3_072711026;
+		tmp3 *= FIX_1_501321110;
+		z1 *= -FIX_0_899976223;
+		z2 *= -FIX_2_562915447;
+		z3 = z3 * -FIX_1_961570560 + z5;
+		z4 = z4 * -FIX_0_390180644 + z5;
+		tmp0 += z1 + z3;
+		tmp1 += z2 + z4;
+		tmp2 += z2 + z3;
+		tmp3 += z1 + z4;
+
+		out[0] = ClampSample(Descale(tmp10 + tmp3, shift) + 128);
+		out[7] = ClampSample(Descale(tmp10 - tmp3, shift) + 128);
+		out[1] = ClampSample(Descale(tmp11 + tmp2, shift) + 128);
+		out[6] = ClampSample(Descale(tmp11 - tmp2, shift) + 128);
+		out[2] = ClampSample(Descale(tmp12 + tmp1, shift) + 128);
+		out[5] = ClampSample(Descale(tmp12 - tmp1, shift) + 128);
+		out[3] = ClampSample(Descale(tmp13 + tmp0, shift) + 128);
+		out[4] = ClampSample(Descale(tmp13 - tmp0, shift) + 128);
+	}
+}
+
+/*!
+	@brief One dimension of the reduced inverse DCT. Each output is the average
+		of the 8 / N full size samples it covers, so all 8 coefficients are
+		used, folded onto the N output points. 13 bit constants are
+		0.5 * C(u) * the mean of cos((2x + 1)u * pi / 16) over those samples.
+	@param f first of 8 coefficients
+	@param step distance between coefficients
+	@param o receives N outputs, scaled by 2^13
+*/
+template <uint8_t N>
+static inline void IDCTReduced1D(const int32_t* f, uint8_t step, int32_t* o)
+{
+	const int32_t d = f[0] * 2896;
+	if constexpr (N == 4)
+	{
+		int32_t e2 = f[2 * step] * 2676 - f[6 * step] * 1108;
+		int32_t o0 = f[step] * 3711 + f[3 * step] * 1303 - f[5 * step] * 871 - f[7 * step] * 738;
+		int32_t o1 = f[step] * 1537 - f[3 * step] * 3146 + f[5 * step] * 2102 - f[7 * step] * 306;
+		o[0] = d + e2 + o0;
+		o[3] = d + e2 - o0;
+		o[1] = d - e2 + o1;
+		o[2] = d - e2 - o1;
+	} else {
+		int32_t o0 = f[step] * 2624 - f[3 * step] * 922 + f[5 * step] * 616 - f[7 * step] * 522;
+		o[0] = d + o0;
+		o[1] = d - o0;
+	}
+}
+
+/*!
+	@brief Reduced inverse DCT for scaled decode, N x N box averaged output
+	@param pCoef dequantised coefficients, natural order, within +/- IDCT_COEF_MAX
+	@param pOut top left output sample
+	@param stride bytes between output rows
+	@note N is 4 for 1/2 scale or 2 for 1/4 scale.
+*/
+template <uint8_t N>
+static void IDCTReduced(const int32_t* pCoef, uint8_t* pOut, uint8_t stride)
+{
+	int32_t work[N * 8]; // N rows of 8 columns
+	int32_t col[N];
+	for (uint8_t u = 0; u < 8; u++)
+	{
+		const int32_t* in = pCoef + u;
+		if (in[8] == 0 && in[16] == 0 && in[24] == 0 && in[32] == 0 &&
+			in[40] == 0 && in[48] == 0 && in[56] == 0)
+		{
+			int32_t dc = Descale(in[0] * 2896, IDCT_CONST_BITS - IDCT_PASS1_BITS);
+			for (uint8_t y = 0; y < N; y++) work[y * 8 + u] = dc;
+			continue;
+		}
+		IDCTReduced1D<N>(in, 8, col);
+		for (uint8_t y = 0; y < N; y++) work[y * 8 + u] = Descale(col[y], IDCT_CONST_BITS - IDCT_PASS1_BITS);
+	}
+	int32_t row[N];
+	for (uint8_t y = 0; y < N; y++)
+	{
+		IDCTReduced1D<N>(work + y * 8, 1, row);
+		for (uint8_t x = 0; x < N; x++)
+			pOut[y * stride + x] = ClampSample(Descale(row[x], IDCT_CONST_BITS + IDCT_PASS1_BITS) + 128);
+	}
+}
+
+/*!
+	@brief Destructor, closes any open file
+*/
+jpegDecoder::~jpegDecoder()
+{
+	close();
+}
+
+/*!
+	@brief Open a JPEG image file and read its header
+	@param path file system path of the image
+	@return enum rvlDisplay_Return_Codes_e
+		-# rvlDisplay_Success for success
+		-# rvlDisplay_FileOpen file could not be opened
+		-# rvlDisplay_FileFormat not a JPEG image, or a kind not supported
+	@note The file is read a buffer at a time as the image is decoded.
+*/
+rvlDisplay_Return_Codes_e jpegDecoder::open(const char* path)
+{
+	close();
+	if (path == nullptr || (_pFile = fopen(path, "rb")) == nullptr)
+	{
+		std::cout << "Error jpegDecoder open 1: File could not be opened : " << (path ? path : "nullptr") << std::endl;
+		return rvlDisplay_FileOpen;
+	}
+	_pBuf = _readBuffer;
+	return readHeader();
+}
+
+/*!
+	@brief Open a JPEG image held in memory and read its header
+	@param pData image data, must stay valid while the decoder is used
+	@param len bytes of image data
+	@return enum rvlDisplay_Return_Codes_e
+		-# rvlDisplay_Success for success
+		-# rvlDisplay_BitmapNullptr pData is nullptr
+		-# rvlDisplay_FileFormat not a JPEG image, or a kind not supported
+*/
+rvlDisplay_Return_Codes_e jpegDecoder::open(const uint8_t* pData, size_t len)
+{
+	close();
+	if (pData == nullptr)
+	{
+		std::cout << "Error jpegDecoder open 2: data is nullptr" << std::endl;
+		return rvlDisplay_BitmapNullptr;
+	}
+	_pBuf = pData;
+	_end = len;
+	return readHeader();
+}
+
+/*!
+	@brief Close any open file
+*/
+void jpegDecoder::close(void)
+{
+	if (_pFile != nullptr)
+	{
+		fclose(_pFile);
+		_pFile = nullptr;
+	}
+	_pBuf = nullptr;
+	_pos = _end = 0;
+	_width = _height = 0;
+	_numComponents = 0;
+	_row = 0;
+}
+
+/*!
+	@brief Go back to the first MCU row to decode the image again
+	@return enum rvlDisplay_Return_Codes_e, see open
+	@note The scale is kept.
+*/
+rvlDisplay_Return_Codes_e jpegDecoder::rewind(void)
+{
+	if (_pBuf == nullptr) return rvlDisplay_BitmapNullptr;
+	if (_pFile != nullptr)
+	{
+		_end = 0;
+		if (fseek(_pFile, 0, SEEK_SET) != 0) return rvlDisplay_FileRead;
+	}
+	_pos = 0;
+	return readHeader();
+}
+
+/*!
+	@brief Set the output scale, takes effect from the next rewind or open
+	@param scale JPEG_Scale_1, JPEG_Scale_2, JPEG_Scale_4 or JPEG_Scale_8
+*/
+void jpegDecoder::setScale(JPEGScale_e scale)
+{
+	_scale = (scale > JPEG_Scale_8) ? JPEG_Scale_8 : scale;
+}
+
+/*!
+	@return rows the next readMCURow will return, less than stripHeight for the
+		last MCU row of an image whose height is not a multiple of the MCU height
+*/
+uint16_t jpegDecoder::stripRows(void) const
+{
+	uint16_t left = (_row < scaledHeight()) ? scaledHeight() - _row : 0;
+	return (left < stripHeight()) ? left : stripHeight();
+}
+
+/*!
+	@brief Decode the next MCU row, converted to big endian RGB565
+	@param x first output column to keep, at the current scale
+	@param w number of columns to keep
+	@param pDst destination, receives stripRows() * w * 2 bytes, or nullptr to
+		decode the row without output
+	@return enum rvlDisplay_Return_Codes_e
+		-# rvlDisplay_Success for success
+		-# rvlDisplay_BitmapNullptr no image open
+		-# rvlDisplay_BitmapScreenBounds no rows left or columns outside the image
+		-# rvlDisplay_FileFormat corrupt entropy coded data
+		-# rvlDisplay_FileRead data ends before the image does
+	@note The entropy coded data of every MCU has to be decoded, the inverse
+		DCT and colour conversion only run for MCUs with kept columns.
+*/
+rvlDisplay_Return_Codes_e jpegDecoder::readMCURow(uint16_t x, uint16_t w, uint8_t* pDst)
+{
+	if (_pBuf == nullptr)
+	{
+		std::cout << "Error jpegDecoder readMCURow 1: No image open" << std::endl;
+		return rvlDisplay_BitmapNullptr;
+	}
+	if (_row >= scaledHeight() || (pDst != nullptr && (uint32_t)x + w > scaledWidth()))
+	{
+		std::cout << "Error jpegDecoder readMCURow 2: Rows or columns outside image" << std::endl;
+		return rvlDisplay_BitmapScreenBounds;
+	}
+	const uint16_t rows = stripRows();
+	const uint32_t mcuW = (_maxH * 8) >> _scale;
+	for (uint16_t mcuX = 0; mcuX < _mcusX; mcuX++)
+	{
+		bool output = pDst != nullptr && mcuX * mcuW < (uint32_t)x + w && (mcuX + 1) * mcuW > x;
+		if (!decodeMCU(output))
+		{
+			std::cout << "Error jpegDecoder readMCURow 3: Corrupt JPEG data" << std::endl;
+			return rvlDisplay_FileFormat;
+		}
+		if (output) outputMCU(mcuX, rows, x, w, pDst);
+	}
+	_row += rows;
+	if (_dataEnd)
+	{
+		std::cout << "Error jpegDecoder readMCURow 4: data ends before the image is complete" << std::endl;
+		return rvlDisplay_FileRead;
+	}
+	return rvlDisplay_Success;
+}
+
+/*!
+	@brief Parse markers from the start of the image up to the first scan, reset decoder state
+	@return enum rvlDisplay_Return_Codes_e, see open
+*/
+rvlDisplay_Return_Codes_e jpegDecoder::readHeader(void)
+{
+	_bitBuf = 0;
+	_bitCount = 0;
+	_marker = 0;
+	_dataEnd = false;
+	_restartInterval = 0;
+	_row = 0;
+	_numComponents = 0;
+	for (uint8_t i = 0; i < 2; i++) _huffDC[i].defined = _huffAC[i].defined = false;
+
+	uint8_t b0 = 0, b1 = 0;
+	if (!getByte(b0) || !getByte(b1) || b0 != 0xFF || b1 != JPEG_SOI)
+	{
+		std::cout << "Error jpegDecoder open 3: Not a JPEG image" << std::endl;
+		close();
+		return rvlDisplay_FileFormat;
+	}
+	rvlDisplay_Return_Codes_e returnCode = rvlDisplay_Success;
+	for (;;)
+	{
+		uint8_t marker = 0;
+		if (!getByte(b0) || b0 != 0xFF) break;
+		do {
+			if (!getByte(marker)) break;
+		} while (marker == 0xFF);
+		if (marker == 0x01 || (marker >= JPEG_RST0 && marker <= JPEG_SOI)) continue; // no length
+		uint16_t len = 0;
+		if (marker == JPEG_EOI || !getWord(len) || len < 2) break;
+		len -= 2;
+		switch (marker)
+		{
+			case JPEG_SOF0:
+			case JPEG_SOF1: returnCode = readSOF(len); break;
+			case JPEG_DHT: returnCode = readDHT(len); break;
+			case JPEG_DQT: returnCode = readDQT(len); break;
+			case JPEG_DRI:
+				if (len != 2 || !getWord(_restartInterval)) returnCode = rvlDisplay_FileFormat;
+				break;
+			case JPEG_SOS:
+				returnCode = readSOS(len);
+				if (returnCode != rvlDisplay_Success) break;
+				_restartsLeft = _restartInterval;
+				setupComponents();
+				return rvlDisplay_Success;
+			default:
+				if ((marker & 0xF0) == 0xC0 && marker != 0xC8 && marker != 0xCC)
+				{
+					std::cout << "Error jpegDecoder open 4: Only baseline and extended sequential Huffman JPEG supported" << std::endl;
+					close();
+					return rvlDisplay_FileFormat;
+				}
+				if (!skipBytes(len)) returnCode = rvlDisplay_FileFormat;
+				break;
+		}
+		if (returnCode != rvlDisplay_Success) break;
+	}
+	std::cout << "Error jpegDecoder open 5: Bad or unsupported JPEG header" << std::endl;
+	close();
+	return rvlDisplay_FileFormat;
+}
+
+/*!
+	@brief Read a DQT segment, one or more quantisation tables
+	@param len bytes of segment after the length field
+	@return rvlDisplay_Success or rvlDisplay_FileFormat
+	@note 16 bit tables are accepted only with every step 255 or less, the
+		range IDCT_COEF_MAX is set for.
+*/
+rvlDisplay_Return_Codes_e jpegDecoder::readDQT(uint16_t len)
+{
+	while (len > 0)
+	{
+		uint8_t pqtq;
+		if (!getByte(pqtq) || (pqtq & 0x0F) > 3 || (pqtq >> 4) > 1) return rvlDisplay_FileFormat;
+		const bool wide = (pqtq >> 4) == 1;
+		const uint16_t size = 1 + 64 * (wide ? 2 : 1);
+		if (len < size) return rvlDisplay_FileFormat;
+		uint16_t* q = _quant[pqtq & 0x0F];
+		for (uint8_t k = 0; k < 64; k++)
+		{
+			uint8_t b = 0;
+			if (wide)
+			{
+				if (!getWord(q[k]) || q[k] > 255) return rvlDisplay_FileFormat;
+			} else {
+				if (!getByte(b)) return rvlDisplay_FileFormat;
+				q[k] = b;
+			}
+		}
+		len -= size;
+	}
+	return rvlDisplay_Success;
+}
+
+/*!
+	@brief Read a DHT segment, one or more Huffman tables, and build their lookups
+	@param len bytes of segment after the length field
+	@return rvlDisplay_Success or rvlDisplay_FileFormat
+*/
+rvlDisplay_Return_Codes_e jpegDecoder::readDHT(uint16_t len)
+{
+	while (len > 0)
+	{
+		uint8_t tcth;
+		uint8_t counts[16];
+		if (len < 17 || !getByte(tcth) || (tcth >> 4) > 1 || (tcth & 0x0F) > 1) return rvlDisplay_FileFormat;
+		uint16_t total = 0;
+		for (uint8_t i = 0; i < 16; i++)
+		{
+			if (!getByte(counts[i])) return rvlDisplay_FileFormat;
+			total += counts[i];
+		}
+		if (total > 256 || len < 17 + total) return rvlDisplay_FileFormat;
+		HuffTable& t = (tcth >> 4) ? _huffAC[tcth & 0x0F] : _huffDC[tcth & 0x0F];
+		for (uint16_t i = 0; i < total; i++)
+		{
+			if (!getByte(t.values[i])) return rvlDisplay_FileFormat;
+		}
+		// Canonical codes, shortest first
+		memset(t.lookup, 0, sizeof(t.lookup));
+		int32_t code = 0;
+		uint16_t k = 0;
+		for (uint8_t bits = 1; bits <= 16; bits++)
+		{
+			t.valOffset[bits] = k - code;
+			// Over subscribed, more codes than this length has room for
+			if (code + counts[bits - 1] > (1 << bits)) return rvlDisplay_FileFormat;
+			for (uint8_t i = 0; i < counts[bits - 1]; i++, k++, code++)
+			{
+				if (bits <= RVL_JPEG_HUFF_LOOKUP_BITS)
+				{
+					uint8_t spare = RVL_JPEG_HUFF_LOOKUP_BITS - bits;
+					for (uint16_t j = 0; j < (1 << spare); j++)
+						t.lookup[(code << spare) | j] = (bits << 8) | t.values[k];
+				}
+			}
+			t.maxCode[bits] = counts[bits - 1] ? code - 1 : -1;
+			code <<= 1;
+		}
+		t.defined = true;
+		len -= 17 + total;
+	}
+	return rvlDisplay_Success;
+}
+
+/*!
+	@brief Read a SOF0 or SOF1 segment, image size and components
+	@param len bytes of segment after the length field
+	@return rvlDisplay_Success or rvlDisplay_FileFormat
+*/
+rvlDisplay_Return_Codes_e jpegDecoder::readSOF(uint16_t len)
+{
+	uint8_t precision, count;
+	uint16_t height, width;
+	if (!getByte(precision) || !getWord(height) || !getWord(width) || !getByte(count))
+		return rvlDisplay_FileFormat;
+	if (precision != 8 || height == 0 || width == 0 || (count != 1 && count != 3) || len != 6 + count * 3)
+		return rvlDisplay_FileFormat;
+	_maxH = _maxV = 1;
+	for (uint8_t i = 0; i < count; i++)
+	{
+		Component& c = _comp[i];
+		uint8_t hv;
+		if (!getByte(c.id) || !getByte(hv) || !getByte(c.tq) || c.tq > 3) return rvlDisplay_FileFormat;
+		c.h = (count == 1) ? 1 : hv >> 4;
+		c.v = (count == 1) ? 1 : hv & 0x0F;
+		if (c.h < 1 || c.h > 2 || c.v < 1 || c.v > 2) return rvlDisplay_FileFormat;
+		if (c.h > _maxH) _maxH = c.h;
+		if (c.v > _maxV) _maxV = c.v;
+	}
+	_width = width;
+	_height = height;
+	_numComponents = count;
+	_mcusX = (_width + _maxH * 8 - 1) / (_maxH * 8);
+	return rvlDisplay_Success;
+}
+
+/*!
+	@brief Read a SOS segment, the scan must hold every component
+	@param len bytes of segment after the length field
+	@return rvlDisplay_Success or rvlDisplay_FileFormat
+*/
+rvlDisplay_Return_Codes_e jpegDecoder::readSOS(uint16_t len)
+{
+	uint8_t count;
+	if (_numComponents == 0 || !getByte(count) || count != _numComponents || len != 4 + count * 2)
+		return rvlDisplay_FileFormat;
+	for (uint8_t i = 0; i < count; i++)
+	{
+		uint8_t id, tdta;
+		if (!getByte(id) || !getByte(tdta)) return rvlDisplay_FileFormat;
+		Component& c = _comp[i];
+		if (c.id != id || (tdta >> 4) > 1 || (tdta & 0x0F) > 1) return rvlDisplay_FileFormat;
+		c.td = tdta >> 4;
+		c.ta = tdta & 0x0F;
+		if (!_huffDC[c.td].defined || !_huffAC[c.ta].defined) return rvlDisplay_FileFormat;
+		c.dcPred = 0;
+	}
+	return skipBytes(3) ? rvlDisplay_Success : rvlDisplay_FileFormat; // Ss, Se, Ah Al
+}
+
+/*!
+	@brief Set each component's decode scale and how its samples map to output pixels
+	@details Chroma subsampled both ways (4:2:0) is decoded one scale step
+		larger when scaling, so it keeps the resolution of the output rather
+		than being stretched over 2x2 pixels. Other components use the output scale.
+*/
+void jpegDecoder::setupComponents(void)
+{
+	for (uint8_t i = 0; i < _numComponents; i++)
+	{
+		Component& c = _comp[i];
+		const bool halfBoth = c.h < _maxH && c.v < _maxV;
+		c.scale = (halfBoth && _scale > JPEG_Scale_1) ? _scale - 1 : _scale;
+		c.stride = c.h * (8 >> c.scale);
+		c.hShift = (_maxH > c.h) - (_scale - c.scale);
+		c.vShift = (_maxV > c.v) - (_scale - c.scale);
+	}
+}
+
+/*!
+	@brief Decode the blocks of one MCU into the component sample buffers
+	@param output false to decode the entropy coded data only
+	@return false if the data is corrupt
+*/
+bool jpegDecoder::decodeMCU(bool output)
+{
+	if (_restartInterval != 0)
+	{
+		if (_restartsLeft == 0) processRestart();
+		_restartsLeft--;
+	}
+	for (uint8_t i = 0; i < _numComponents; i++)
+	{
+		Component& c = _comp[i];
+		const uint8_t bs = 8 >> c.scale;
+		const uint8_t stride = c.h * bs;
+		for (uint8_t by = 0; by < c.v; by++)
+		{
+			for (uint8_t bx = 0; bx < c.h; bx++)
+			{
+				if (!decodeBlock(c, c.samples + by * bs * stride + bx * bs, stride, output)) return false;
+			}
+		}
+	}
+	return true;
+}
+
+/*!
+	@brief Decode one 8x8 block, dequantise and inverse transform it at the current scale
+	@param comp component the block belongs to
+	@param pOut top left output sample
+	@param stride bytes between output rows
+	@param output false to decode the entropy coded data only
+	@return false if the data is corrupt
+*/
+bool jpegDecoder::decodeBlock(Component& comp, uint8_t* pOut, uint8_t stride, bool output)
+{
+	const uint16_t* q = _quant[comp.tq];
+	int32_t coef[64];
+	int16_t s = decodeHuffman(_huffDC[comp.td]);
+	if (s < 0 || s > 11) return false;
+	comp.dcPred += receiveExtend(s);
+	if (comp.dcPred > JPEG_DC_MAX) comp.dcPred = JPEG_DC_MAX;
+	else if (comp.dcPred < -JPEG_DC_MAX) comp.dcPred = -JPEG_DC_MAX;
+	const bool storeAC = output && comp.scale != JPEG_Scale_8; // 1/8 scale needs only DC
+	if (storeAC) memset(coef, 0, sizeof(coef));
+	coef[0] = Dequantise(comp.dcPred, q[0]);
+	const HuffTable& ac = _huffAC[comp.ta];
+	for (uint8_t k = 1; k < 64; k++)
+	{
+		int16_t rs = decodeHuffman(ac);
+		if (rs < 0) return false;
+		uint8_t run = rs >> 4, size = rs & 0x0F;
+		if (size == 0)
+		{
+			if (run != 15) break; // end of block
+			k += 15;
+			continue;
+		}
+		k += run;
+		if (k > 63) return false;
+		int32_t v = receiveExtend(size);
+		if (storeAC) coef[ZigZag[k]] = Dequantise(v, q[k]);
+	}
+	if (!output) return true;
+
+	switch (comp.scale)
+	{
+		case JPEG_Scale_1: IDCT8x8(coef, pOut, stride); break;
+		case JPEG_Scale_2: IDCTReduced<4>(coef, pOut, stride); break;
+		case JPEG_Scale_4: IDCTReduced<2>(coef, pOut, stride); break;
+		case JPEG_Scale_8: *pOut = ClampSample(Descale(coef[0], 3) + 128); break;
+	}
+	return true;
+}
+
+/*!
+	@brief Restart interval reached, drop the remaining bits, find the RSTn
+		marker and reset the DC predictors
+*/
+void jpegDecoder::processRestart(void)
+{
+	_bitBuf = 0;
+	_bitCount = 0;
+	uint8_t b = 0;
+	while (_marker == 0 && getByte(b))
+	{
+		if (b != 0xFF) continue;
+		do {
+			if (!getByte(b)) break;
+		} while (b == 0xFF);
+		if (b != 0) _marker = b;
+	}
+	if (_marker >= JPEG_RST0 && _marker <= JPEG_RST7) _marker = 0;
+	for (uint8_t i = 0; i < _numComponents; i++) _comp[i].dcPred = 0;
+	_restartsLeft = _restartInterval;
+}
+
+/*!
+	@brief Colour convert the kept columns of one decoded MCU into the output strip
+	@param mcuX MCU column
+	@param rows output rows in this MCU row
+	@param x first output column kept
+	@param w number of output columns kept, row length of pDst
+	@param pDst output strip, big endian RGB565
+*/
+void jpegDecoder::outputMCU(uint16_t mcuX, uint16_t rows, uint16_t x, uint16_t w, uint8_t* pDst)
+{
+	const uint16_t mcuW = (_maxH * 8) >> _scale;
+	const uint16_t left = mcuX * mcuW;
+	const uint16_t x0 = (left > x) ? left : x;
+	const uint16_t x1 = (left + mcuW < x + w) ? left + mcuW : x + w;
+	const Component& cy = _comp[0];
+	const uint8_t hsY = cy.hShift;
+	for (uint16_t py = 0; py < rows; py++)
+	{
+		uint8_t* d = pDst + ((uint32_t)py * w + (x0 - x)) * 2;
+		const uint8_t* pY = cy.samples + (py >> cy.vShift) * cy.stride;
+		if (_numComponents == 1)
+		{
+			for (uint16_t gx = x0; gx < x1; gx++)
+			{
+				uint8_t g = pY[(gx - left) >> hsY];
+				*d++ = (g & 0xF8) | (g >> 5);
+				*d++ = ((g & 0x1C) << 3) | (g >> 3);
+			}
+			continue;
+		}
+		const Component& cb = _comp[1];
+		const Component& cr = _comp[2];
+		const uint8_t* pCb = cb.samples + (py >> cb.vShift) * cb.stride;
+		const uint8_t* pCr = cr.samples + (py >> cr.vShift) * cr.stride;
+		const uint8_t hsCb = cb.hShift, hsCr = cr.hShift;
+		for (uint16_t gx = x0; gx < x1; gx++)
+		{
+			const uint16_t px = gx - left;
+			int32_t lum = pY[px >> hsY];
+			int32_t b = pCb[px >> hsCb] - 128;
+			int32_t r = pCr[px >> hsCr] - 128;
+			uint8_t red = ClampSample(lum + ((91881 * r + 32768) >> 16));
+			uint8_t green = ClampSample(lum + ((-22554 * b - 46802 * r + 32768) >> 16));
+			uint8_t blue = ClampSample(lum + ((116130 * b + 32768) >> 16));
+			*d++ = (red & 0xF8) | (green >> 5);
+			*d++ = ((green & 0x1C) << 3) | (blue >> 3);
+		}
+	}
+}
+
+/*!
+	@brief Get the next byte of the image, reading the file if needed
+	@param b receives the byte
+	@return false at the end of the data
+*/
+bool jpegDecoder::getByte(uint8_t& b)
+{
+	if (_pos >= _end)
+	{
+		if (_pFile == nullptr) return false;
+		_end = fread(_readBuffer, 1, RVL_JPEG_READ_BUFFER_SIZE, _pFile);
+		_pos = 0;
+		if (_end == 0) return false;
+	}
+	b = _pBuf[_pos++];
+	return true;
+}
+
+/*!
+	@brief Get a big endian 16 bit header field
+	@param w receives the value
+	@return false at the end of the data
+*/
+bool jpegDecoder::getWord(uint16_t& w)
+{
+	uint8_t hi, lo;
+	if (!getByte(hi) || !getByte(lo)) return false;
+	w = (hi << 8) | lo;
+	return true;
+}
+
+/*!
+	@brief Skip header bytes, seeking the file for long segments such as thumbnails
+	@param n bytes to skip
+	@return false if the data ends first
+*/
+bool jpegDecoder::skipBytes(uint32_t n)
+{
+	uint32_t inBuffer = _end - _pos;
+	if (n <= inBuffer)
+	{
+		_pos += n;
+		return true;
+	}
+	_pos = _end;
+	n -= inBuffer;
+	if (_pFile == nullptr) return false;
+	return fseek(_pFile, n, SEEK_CUR) == 0;
+}
+
+/*!
+	@brief Next byte of entropy coded data, with byte stuffing removed
+	@return the byte, or 0 once a marker or the end of the data is reached
+*/
+uint8_t jpegDecoder::nextScanByte(void)
+{
+	if (_marker != 0) return 0;
+	uint8_t b;
+	if (!getByte(b))
+	{
+		_dataEnd = true;
+		_marker = JPEG_EOI;
+		return 0;
+	}
+	if (b != 0xFF) return b;
+	do {
+		if (!getByte(b))
+		{
+			_dataEnd = true;
+			_marker = JPEG_EOI;
+			return 0;
+		}
+	} while (b == 0xFF);
+	if (b == 0) return 0xFF;
+	_marker = b;
+	return 0;
+}
+
+/*!
+	@brief Top up the bit buffer to at least 25 bits
+*/
+void jpegDecoder::fillBits(void)
+{
+	while (_bitCount <= 24)
+	{
+		_bitBuf = (_bitBuf << 8) | nextScanByte();
+		_bitCount += 8;
+	}
+}
+
+/*!
+	@brief Take bits from the entropy coded data
+	@param n number of bits, 0 to 16
+	@return the bits, first bit most significant
+*/
+uint32_t jpegDecoder::getBits(uint8_t n)
+{
+	if (n == 0) return 0;
+	if (_bitCount < n) fillBits();
+	_bitCount -= n;
+	return (_bitBuf >> _bitCount) & ((1u << n) - 1);
+}
+
+/*!
+	@brief Take an n bit coefficient value and sign extend it
+	@param n size category, 0 to 15
+	@return the signed value
+*/
+int32_t jpegDecoder::receiveExtend(uint8_t n)
+{
+	if (n == 0) return 0;
+	int32_t v = getBits(n);
+	return (v < (1 << (n - 1))) ? v - (1 << n) + 1 : v;
+}
+
+/*!
+	@brief Decode one Huffman coded symbol
+	@param table DC or AC table
+	@return the symbol, or -1 for an invalid code
+*/
+int16_t jpegDecoder::decodeHuffman(const HuffTable& table)
+{
+	if (_bitCount < 16) fillBits();
+	uint16_t entry = table.lookup[(_bitBuf >> (_bitCount - RVL_JPEG_HUFF_LOOKUP_BITS)) & ((1 << RVL_JPEG_HUFF_LOOKUP_BITS) - 1)];
+	if (entry != 0)
+	{
+		_bitCount -= entry >> 8;
+		return entry & 0xFF;
+	}
+	for (uint8_t bits = RVL_JPEG_HUFF_LOOKUP_BITS + 1; bits <= 16; bits++)
+	{
+		int32_t code = (_bitBuf >> (_bitCount - bits)) & ((1 << bits) - 1);
+		if (code <= table.maxCode[bits])
+		{
+			_bitCount -= bits;
+			return table.values[code + table.valOffset[bits]];
+		}
+	}
+	return -1;
+}
+
+// **************** EOF *****************
@@ -0,0 +1,219 @@
+/*!
+	@file     pixel_convert_RVL.cpp
+	@author   Gavin Lyons
+	@brief    Row conversion kernels to panel native big endian RGB565.
+				Project Name: ST7789_TFT_RPI
+*/
+
+#include <cstring>
+#include <algorithm>
+#include "../include/pixel_convert_RVL.hpp"
+
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#define RVL_CONVERT_NEON
+#elif defined(__SSSE3__)
+#include <tmmintrin.h>
+#define RVL_CONVERT_SSSE3
+#endif
+
+#ifdef RVL_CONVERT_SSSE3
+/*!
+	@brief Pack four 32 bit lanes holding B | G<<8 | R<<16 into 565 in the low 16 bits
+*/
+static inline __m128i Pack565Lanes(__m128i bgr)
+{
+	__m128i r = _mm_and_si128(_mm_srli_epi32(bgr, 8), _mm_set1_epi32(0xF800));
+	__m128i g = _mm_and_si128(_mm_srli_epi32(bgr, 5), _mm_set1_epi32(0x07E0));
+	__m128i b = _mm_and_si128(_mm_srli_epi32(bgr, 3), _mm_set1_epi32(0x001F));
+	return _mm_or_si128(r, _mm_or_si128(g, b));
+}
+#endif
+
+/*!
+	@brief Convert a row of packed BGR888 pixels (24 bit BMP order) to big endian RGB565
+	@param pSrc source pixels, 3 bytes each, Blue Green Red
+	@param pDst destination, 2 bytes each, high byte first as the display expects
+	@param pixels number of pixels to convert
+	@note 3 byte to 2 byte, RRRR RRRR GGGG GGGG BBBB BBBB => RRRRR GGGGGG BBBBB.
+		Same result as Color565 per pixel.
+*/
+void ConvertBGR888toRGB565BE(const uint8_t* pSrc, uint8_t* pDst, uint32_t pixels)
+{
+	uint32_t i = 0;
+#if defined(RVL_CONVERT_NEON)
+	// 16 pixels per pass, vld3 de-interleaves B, G, R planes, exactly 48 bytes read
+	const uint8x16_t maskR = vdupq_n_u8(0xF8);
+	const uint8x16_t maskG = vdupq_n_u8(0x1C);
+	for (; i + 16 <= pixels; i += 16)
+	{
+		uint8x16x3_t bgr = vld3q_u8(pSrc + i * 3);
+		uint8x16x2_t out;
+		out.val[0] = vorrq_u8(vandq_u8(bgr.val[2], maskR), vshrq_n_u8(bgr.val[1], 5));
+		out.val[1] = vorrq_u8(vshlq_n_u8(vandq_u8(bgr.val[1], maskG), 3), vshrq_n_u8(bgr.val[0], 3));
+		vst2q_u8(pDst + i * 2, out);
+	}
+#elif defined(RVL_CONVERT_SSSE3)
+	// 8 pixels per pass from two 16 byte loads at offsets 0 and 12, each load
+	// over-reads 4 bytes so stop while at least 10 pixels (30 bytes) remain.
+	const __m128i spread = _mm_setr_epi8(0, 1, 2, -1, 3, 4, 5, -1, 6, 7, 8, -1, 9, 10, 11, -1);
+	const __m128i packLow = _mm_setr_epi8(1, 0, 5, 4, 9, 8, 13, 12, -1, -1, -1, -1, -1, -1, -1, -1);
+	const __m128i packHigh = _mm_setr_epi8(-1, -1, -1, -1, -1, -1, -1, -1, 1, 0, 5, 4, 9, 8, 13, 12);
+	for (; i + 10 <= pixels; i += 8)
+	{
+		__m128i a = _mm_loadu_si128((const __m128i*)(pSrc + i * 3));
+		__m128i b = _mm_loadu_si128((const __m128i*)(pSrc + i * 3 + 12));
+		a = Pack565Lanes(_mm_shuffle_epi8(a, spread));
+		b = Pack565Lanes(_mm_shuffle_epi8(b, spread));
+		__m128i out = _mm_or_si128(_mm_shuffle_epi8(a, packLow), _mm_shuffle_epi8(b, packHigh));
+		_mm_storeu_si128((__m128i*)(pDst + i * 2), out);
+	}
+#endif
+	// Portable path and tail, byte loads only
+	for (; i < pixels; i++)
+	{
+		const uint8_t* p = pSrc + i * 3;
+		pDst[i * 2]     = (p[2] & 0xF8) | (p[1] >> 5);
+		pDst[i * 2 + 1] = ((p[1] & 0x1C) << 3) | (p[0] >> 3);
+	}
+}
+
+/*!
+	@brief Convert a row of little endian RGB565 pixels (16 bit BMP order) to big endian RGB565
+	@param pSrc source pixels, 2 bytes each, low byte first
+	@param pDst destination, 2 bytes each, high byte first as the display expects
+	@param pixels number of pixels to convert
+	@note pSrc and pDst may be the same buffer to swap in place
+*/
+void ConvertRGB565LEtoBE(const uint8_t* pSrc, uint8_t* pDst, uint32_t pixels)
+{
+	uint32_t i = 0;
+#if defined(RVL_CONVERT_NEON)
+	for (; i + 8 <= pixels; i += 8)
+	{
+		vst1q_u8(pDst + i * 2, vrev16q_u8(vld1q_u8(pSrc + i * 2)));
+	}
+#elif defined(RVL_CONVERT_SSSE3)
+	const __m128i swap = _mm_setr_epi8(1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14);
+	for (; i + 8 <= pixels; i += 8)
+	{
+		__m128i v = _mm_loadu_si128((const __m128i*)(pSrc + i * 2));
+		_mm_storeu_si128((__m128i*)(pDst + i * 2), _mm_shuffle_epi8(v, swap));
+	}
+#endif
+	for (; i < pixels; i++)
+	{
+		uint8_t lo = pSrc[i * 2];
+		pDst[i * 2] = pSrc[i * 2 + 1];
+		pDst[i * 2 + 1] = lo;
+	}
+}
+
+/*!
+	@brief Convert a row of BGRA8888 / BGRX8888 pixels (32 bit BMP order) to big endian RGB565
+	@param pSrc source pixels, 4 bytes each, Blue Green Red Alpha
+	@param pDst destination, 2 bytes each, high byte first as the display expects
+	@param pixels number of pixels to convert
+	@note Alpha is ignored.
+*/
+void ConvertBGRA8888toRGB565BE(const uint8_t* pSrc, uint8_t* pDst, uint32_t pixels)
+{
+	uint32_t i = 0;
+#if defined(RVL_CONVERT_NEON)
+	const uint8x16_t maskR = vdupq_n_u8(0xF8);
+	const uint8x16_t maskG = vdupq_n_u8(0x1C);
+	for (; i + 16 <= pixels; i += 16)
+	{
+		uint8x16x4_t bgra = vld4q_u8(pSrc + i * 4);
+		uint8x16x2_t out;
+		out.val[0] = vorrq_u8(vandq_u8(bgra.val[2], maskR), vshrq_n_u8(bgra.val[1], 5));
+		out.val[1] = vorrq_u8(vshlq_n_u8(vandq_u8(bgra.val[1], maskG), 3), vshrq_n_u8(bgra.val[0], 3));
+		vst2q_u8(pDst + i * 2, out);
+	}
+#elif defined(RVL_CONVERT_SSSE3)
+	// Pixels are already one per 32 bit lane, Pack565Lanes drops the alpha byte
+	const __m128i packLow = _mm_setr_epi8(1, 0, 5, 4, 9, 8, 13, 12, -1, -1, -1, -1, -1, -1, -1, -1);
+	const __m128i packHigh = _mm_setr_epi8(-1, -1, -1, -1, -1, -1, -1, -1, 1, 0, 5, 4, 9, 8, 13, 12);
+	for (; i + 8 <= pixels; i += 8)
+	{
+		__m128i a = Pack565Lanes(_mm_loadu_si128((const __m128i*)(pSrc + i * 4)));
+		__m128i b = Pack565Lanes(_mm_loadu_si128((const __m128i*)(pSrc + i * 4 + 16)));
+		__m128i out = _mm_or_si128(_mm_shuffle_epi8(a, packLow), _mm_shuffle_epi8(b, packHigh));
+		_mm_storeu_si128((__m128i*)(pDst + i * 2), out);
+	}
+#endif
+	for (; i < pixels; i++)
+	{
+		const uint8_t* p = pSrc + i * 4;
+		pDst[i * 2]     = (p[2] & 0xF8) | (p[1] >> 5);
+		pDst[i * 2 + 1] = ((p[1] & 0x1C) << 3) | (p[0] >> 3);
+	}
+}
+
+/*!
+	@brief Convert a row of little endian X1R5G5B5 pixels (16 bit BMP default) to big endian RGB565
+	@param pSrc source pixels, 2 bytes each, low byte first
+	@param pDst destination, 2 bytes each, high byte first as the display expects
+	@param pixels number of pixels to convert
+	@note Portable only, the format is rare. Green low bit is copied from its top bit.
+*/
+void ConvertRGB555LEtoRGB565BE(const uint8_t* pSrc, uint8_t* pDst, uint32_t pixels)
+{
+	for (uint32_t i = 0; i < pixels; i++)
+	{
+		uint16_t c = pSrc[i * 2] | (pSrc[i * 2 + 1] << 8);
+		uint16_t g = (c >> 5) & 0x1F;
+		uint16_t out = ((c & 0x7C00) << 1) | (g << 6) | ((g >> 4) << 5) | (c & 0x1F);
+		pDst[i * 2] = out >> 8;
+		pDst[i * 2 + 1] = out;
+	}
+}
+
+/*!
+	@brief Build the table for a 1 bit bitmap color pair
+	@param lut table to fill
+	@param color color of set bits
+	@param bgcolor color of clear bits
+*/
+void BuildMono1LUT(rvlMono1LUT_t& lut, uint16_t color, uint16_t bgcolor)
+{
+	for (uint16_t value = 0; value < 256; value++)
+	{
+		for (uint8_t bit = 0; bit < 8; bit++)
+		{
+			uint16_t c = (value & (0x80 >> bit)) ? color : bgcolor;
+			lut.pixels[value][bit * 2] = c >> 8;
+			lut.pixels[value][bit * 2 + 1] = c & 0xFF;
+		}
+	}
+	lut.color = color;
+	lut.bgcolor = bgcolor;
+	lut.valid = true;
+}
+
+/*!
+	@brief Expand a row of a 1 bit bitmap, most significant bit first, to big endian RGB565
+	@param pSrc source byte holding the first pixel
+	@param firstBit bit of the first pixel in *pSrc, 0 = most significant
+	@param pDst destination, 2 bytes each, high byte first as the display expects
+	@param pixels number of pixels to convert
+	@param lut table built by BuildMono1LUT for the colors wanted
+	@note Each whole source byte is one 16 byte copy from the table, a partial
+		byte at either end copies only the pixels needed from its entry.
+*/
+void ConvertMono1toRGB565BE(const uint8_t* pSrc, uint8_t firstBit, uint8_t* pDst, uint32_t pixels, const rvlMono1LUT_t& lut)
+{
+	if (firstBit != 0)
+	{
+		uint32_t n = std::min<uint32_t>(8 - firstBit, pixels);
+		memcpy(pDst, lut.pixels[*pSrc++] + firstBit * 2, n * 2);
+		pDst += n * 2;
+		pixels -= n;
+	}
+	for (; pixels >= 8; pixels -= 8, pDst += 16)
+		memcpy(pDst, lut.pixels[*pSrc++], 16);
+	if (pixels > 0)
+		memcpy(pDst, lut.pixels[*pSrc], pixels * 2);
+}
+
+// **************** EOF *****************
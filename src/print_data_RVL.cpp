@@ -75,12 +75,7 @@ size_t Print::print(long n, int base)
 		return write(n);
 	} else if (base == 10)
 	{
-		if (n < 0)
-		{
-			int t = print('-');
-			n = -n;
-			return printNumber(n, 10) + t;
-		}
+		if (n < 0) return printNumber(0UL - (unsigned long)n, 10, true);
 		return printNumber(n, 10);
 	} else
 	{
@@ -227,10 +222,12 @@ size_t Print::println(const std::string &s) {
  *@brief Used internally to parse and print number
  *@param n Number to parse
  *@param base to print to Binary hexadecimal etc
+ *@param negative print a minus sign before the number
+ *@note The number is written in one call, so the display sends it as one run
  */
-size_t Print::printNumber(unsigned long n, uint8_t base)
+size_t Print::printNumber(unsigned long n, uint8_t base, bool negative)
 {
-	char buf[8 * sizeof(long) + 1]; // Assumes 8-bit chars plus zero byte.
+	char buf[8 * sizeof(long) + 2]; // Assumes 8-bit chars plus sign and zero byte.
 	char *str = &buf[sizeof(buf) - 1];
 
 	*str = '\0';
@@ -244,6 +241,7 @@ size_t Print::printNumber(unsigned long n, uint8_t base)
 
 	*--str = c < 10 ? c + '0' : c + 'A' - 10;
 	} while(n);
+	if (negative) *--str = '-';
 
 	return write(str);
 }
@@ -252,10 +250,12 @@ size_t Print::printNumber(unsigned long n, uint8_t base)
  *@brief Used internally to parse float
  *@param number The floating point number
  *@param digits Number of precision digits to print
+ *@note The number is formatted into a buffer and written in one call
  */
 size_t Print::printFloat(double number, uint8_t digits)
 {
-	size_t n = 0;
+	char buf[8 * sizeof(long) + 2 * 255 + 3]; // sign, integer, point, digits up to 255
+	size_t len = 0;
 
 	if (std::isnan(number)) return print("nan");
 	if (std::isinf(number)) return print("inf");
@@ -265,7 +265,7 @@ size_t Print::printFloat(double number, uint8_t digits)
 	// Handle negative numbers
 	if (number < 0.0)
 	{
-	 n += print('-');
+	 buf[len++] = '-';
 	 number = -number;
 	}
 
@@ -279,11 +279,11 @@ size_t Print::printFloat(double number, uint8_t digits)
 	// Extract the integer part of the number and print it
 	unsigned long int_part = (unsigned long)number;
 	double remainder = number - (double)int_part;
-	n += print(int_part);
+	len += snprintf(buf + len, sizeof(buf) - len, "%lu", int_part);
 
 	// Print the decimal point, but only if there are digits beyond
 	if (digits > 0) {
-	n += print('.');
+	buf[len++] = '.';
 	}
 
 	// Extract digits from the remainder one at a time
@@ -291,9 +291,9 @@ size_t Print::printFloat(double number, uint8_t digits)
 	{
 	remainder *= 10.0;
 	unsigned int toPrint = (unsigned int)(remainder);
-	n += print(toPrint);
+	len += snprintf(buf + len, sizeof(buf) - len, "%u", toPrint);
 	remainder -= toPrint;
 	}
 
-	return n;
+	return write(buf, len);
 }
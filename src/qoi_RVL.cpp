@@ -0,0 +1,374 @@
+/*!
+	@file     qoi_RVL.cpp
+	@author   Gavin Lyons
+	@brief    QOI (Quite OK Image) lossless image format, encoder and streaming decoder.
+				Project Name: ST7789_TFT_RPI
+*/
+
+#include <iostream>
+#include <cstring>
+#include "../include/qoi_RVL.hpp"
+
+// QOI chunk tags
+#define QOI_OP_INDEX 0x00 /**< 00xxxxxx */
+#define QOI_OP_DIFF  0x40 /**< 01xxxxxx */
+#define QOI_OP_LUMA  0x80 /**< 10xxxxxx */
+#define QOI_OP_RUN   0xC0 /**< 11xxxxxx */
+#define QOI_OP_RGB   0xFE /**< 11111110 */
+#define QOI_OP_RGBA  0xFF /**< 11111111 */
+#define QOI_MASK_2   0xC0 /**< 11000000 */
+#define QOI_MAX_CHUNK 5   /**< Largest chunk, QOI_OP_RGBA */
+
+static inline uint8_t QOIHash(uint8_t r, uint8_t g, uint8_t b, uint8_t a)
+{
+	return (r * 3 + g * 5 + b * 7 + a * 11) % 64;
+}
+
+static inline void PutBE32(std::vector<uint8_t>& out, uint32_t v)
+{
+	out.push_back(v >> 24);
+	out.push_back(v >> 16);
+	out.push_back(v >> 8);
+	out.push_back(v);
+}
+
+/*!
+	@brief Encode an image to QOI
+	@param pPixels RGB or RGBA pixels, one byte per channel, rows top down
+	@param w width in pixels
+	@param h height in pixels
+	@param channels 3 for RGB, 4 for RGBA
+	@param out receives the encoded image, replaced
+*/
+void QOIEncode(const uint8_t* pPixels, uint16_t w, uint16_t h, uint8_t channels, std::vector<uint8_t>& out)
+{
+	out.clear();
+	out.insert(out.end(), {'q', 'o', 'i', 'f'});
+	PutBE32(out, w);
+	PutBE32(out, h);
+	out.push_back(channels);
+	out.push_back(0); // sRGB with linear alpha
+
+	uint8_t index[64][4] = {};
+	uint8_t prev[4] = {0, 0, 0, 255};
+	uint8_t run = 0;
+	const uint32_t total = (uint32_t)w * h;
+	for (uint32_t i = 0; i < total; i++)
+	{
+		const uint8_t* p = pPixels + i * channels;
+		uint8_t px[4] = {p[0], p[1], p[2], (uint8_t)(channels == 4 ? p[3] : 255)};
+		if (memcmp(px, prev, 4) == 0)
+		{
+			run++;
+			if (run == 62 || i == total - 1)
+			{
+				out.push_back(QOI_OP_RUN | (run - 1));
+				run = 0;
+			}
+			continue;
+		}
+		if (run > 0)
+		{
+			out.push_back(QOI_OP_RUN | (run - 1));
+			run = 0;
+		}
+		uint8_t hash = QOIHash(px[0], px[1], px[2], px[3]);
+		if (memcmp(index[hash], px, 4) == 0)
+		{
+			out.push_back(QOI_OP_INDEX | hash);
+		} else {
+			memcpy(index[hash], px, 4);
+			if (px[3] == prev[3])
+			{
+				int8_t dr = px[0] - prev[0], dg = px[1] - prev[1], db = px[2] - prev[2];
+				int8_t drdg = dr - dg, dbdg = db - dg;
+				if (dr > -3 && dr < 2 && dg > -3 && dg < 2 && db > -3 && db < 2)
+				{
+					out.push_back(QOI_OP_DIFF | (dr + 2) << 4 | (dg + 2) << 2 | (db + 2));
+				} else if (drdg > -9 && drdg < 8 && dg > -33 && dg < 32 && dbdg > -9 && dbdg < 8) {
+					out.push_back(QOI_OP_LUMA | (dg + 32));
+					out.push_back((drdg + 8) << 4 | (dbdg + 8));
+				} else {
+					out.insert(out.end(), {QOI_OP_RGB, px[0], px[1], px[2]});
+				}
+			} else {
+				out.insert(out.end(), {QOI_OP_RGBA, px[0], px[1], px[2], px[3]});
+			}
+		}
+		memcpy(prev, px, 4);
+	}
+	out.insert(out.end(), {0, 0, 0, 0, 0, 0, 0, 1});
+}
+
+/*!
+	@brief Destructor, closes any open file
+*/
+qoiDecoder::~qoiDecoder()
+{
+	close();
+}
+
+/*!
+	@brief Open a QOI image file
+	@param path file system path of the image
+	@return enum rvlDisplay_Return_Codes_e
+		-# rvlDisplay_Success for success
+		-# rvlDisplay_FileOpen file could not be opened
+		-# rvlDisplay_FileFormat not a QOI image
+	@note The file is read a buffer at a time as the image is decoded.
+*/
+rvlDisplay_Return_Codes_e qoiDecoder::open(const char* path)
+{
+	close();
+	if (path == nullptr || (_pFile = fopen(path, "rb")) == nullptr)
+	{
+		std::cout << "Error qoiDecoder open 1: File could not be opened : " << (path ? path : "nullptr") << std::endl;
+		return rvlDisplay_FileOpen;
+	}
+	_pBuf = _readBuffer;
+	return readHeader();
+}
+
+/*!
+	@brief Open a QOI image held in memory
+	@param pData image data, must stay valid while the decoder is used
+	@param len bytes of image data
+	@return enum rvlDisplay_Return_Codes_e
+		-# rvlDisplay_Success for success
+		-# rvlDisplay_BitmapNullptr pData is nullptr
+		-# rvlDisplay_FileFormat not a QOI image
+*/
+rvlDisplay_Return_Codes_e qoiDecoder::open(const uint8_t* pData, size_t len)
+{
+	close();
+	if (pData == nullptr)
+	{
+		std::cout << "Error qoiDecoder open 2: data is nullptr" << std::endl;
+		return rvlDisplay_BitmapNullptr;
+	}
+	_pBuf = pData;
+	_end = len;
+	_eof = true;
+	return readHeader();
+}
+
+/*!
+	@brief Close any open file
+*/
+void qoiDecoder::close(void)
+{
+	if (_pFile != nullptr)
+	{
+		fclose(_pFile);
+		_pFile = nullptr;
+	}
+	_pBuf = nullptr;
+	_pos = _end = 0;
+	_eof = false;
+	_width = _height = 0;
+	_channels = 0;
+	_row = 0;
+}
+
+/*!
+	@brief Go back to the first row to decode the image again
+	@return enum rvlDisplay_Return_Codes_e, see open
+*/
+rvlDisplay_Return_Codes_e qoiDecoder::rewind(void)
+{
+	if (_pBuf == nullptr) return rvlDisplay_BitmapNullptr;
+	if (_pFile != nullptr)
+	{
+		_end = 0;
+		_eof = false;
+		if (fseek(_pFile, 0, SEEK_SET) != 0) return rvlDisplay_FileRead;
+	}
+	_pos = 0;
+	return readHeader();
+}
+
+/*!
+	@brief Decode the next rows, converted to big endian RGB565
+	@param rows number of rows to decode
+	@param x first column to keep
+	@param w number of columns to keep
+	@param pDst destination, receives rows * w * 2 bytes
+	@return enum rvlDisplay_Return_Codes_e
+		-# rvlDisplay_Success for success
+		-# rvlDisplay_BitmapNullptr no image open or pDst is nullptr
+		-# rvlDisplay_BitmapScreenBounds rows or columns outside the image
+		-# rvlDisplay_FileRead data ends before the image does
+	@note Rows come in order, every pixel of a row is decoded, only columns
+		x to x + w - 1 are stored.
+*/
+rvlDisplay_Return_Codes_e qoiDecoder::readRows(uint16_t rows, uint16_t x, uint16_t w, uint8_t* pDst)
+{
+	if (_pBuf == nullptr || pDst == nullptr)
+	{
+		std::cout << "Error qoiDecoder readRows 1: No image open or buffer is nullptr" << std::endl;
+		return rvlDisplay_BitmapNullptr;
+	}
+	if ((uint32_t)_row + rows > _height || (uint32_t)x + w > _width)
+	{
+		std::cout << "Error qoiDecoder readRows 2: Rows or columns outside image" << std::endl;
+		return rvlDisplay_BitmapScreenBounds;
+	}
+	for (uint16_t j = 0; j < rows; j++)
+	{
+		if (!decodeRow(pDst + (uint32_t)j * w * 2, x, w)) return rvlDisplay_FileRead;
+	}
+	return rvlDisplay_Success;
+}
+
+/*!
+	@brief Decode and throw away the next rows
+	@param rows number of rows to skip
+	@return enum rvlDisplay_Return_Codes_e, see readRows
+*/
+rvlDisplay_Return_Codes_e qoiDecoder::skipRows(uint16_t rows)
+{
+	if (_pBuf == nullptr || (uint32_t)_row + rows > _height) return rvlDisplay_BitmapScreenBounds;
+	for (uint16_t j = 0; j < rows; j++)
+	{
+		if (!decodeRow(nullptr, 0, 0)) return rvlDisplay_FileRead;
+	}
+	return rvlDisplay_Success;
+}
+
+/*!
+	@brief Read and check the header at the start of the data, reset decoder state
+	@return enum rvlDisplay_Return_Codes_e, see open
+*/
+rvlDisplay_Return_Codes_e qoiDecoder::readHeader(void)
+{
+	if (!fill(RVL_QOI_HEADER_SIZE) || memcmp(_pBuf + _pos, "qoif", 4) != 0)
+	{
+		std::cout << "Error qoiDecoder open 3: Not a QOI image" << std::endl;
+		close();
+		return rvlDisplay_FileFormat;
+	}
+	const uint8_t* h = _pBuf + _pos;
+	uint32_t width = (h[4] << 24) | (h[5] << 16) | (h[6] << 8) | h[7];
+	uint32_t height = (h[8] << 24) | (h[9] << 16) | (h[10] << 8) | h[11];
+	uint8_t channels = h[12];
+	if (width == 0 || height == 0 || width > UINT16_MAX || height > UINT16_MAX ||
+		(channels != 3 && channels != 4))
+	{
+		std::cout << "Error qoiDecoder open 4: Unsupported QOI size or channels" << std::endl;
+		close();
+		return rvlDisplay_FileFormat;
+	}
+	_pos += RVL_QOI_HEADER_SIZE;
+	_width = width;
+	_height = height;
+	_channels = channels;
+	_row = 0;
+	_px = {0, 0, 0, 255};
+	_run = 0;
+	memset(_index, 0, sizeof(_index));
+	return rvlDisplay_Success;
+}
+
+/*!
+	@brief Decode one row
+	@param pDst destination for columns x to x + w - 1, nullptr to skip the row
+	@param x first column to keep
+	@param w number of columns to keep
+	@return true on success, false if the data ends first
+*/
+bool qoiDecoder::decodeRow(uint8_t* pDst, uint16_t x, uint16_t w)
+{
+	const uint16_t keepEnd = x + w;
+	Pixel px = _px;
+	uint8_t hi = (px.r & 0xF8) | (px.g >> 5);
+	uint8_t lo = ((px.g & 0x1C) << 3) | (px.b >> 3);
+	for (uint16_t col = 0; col < _width; col++)
+	{
+		if (_run > 0)
+		{
+			_run--;
+		} else {
+			if (_end - _pos < QOI_MAX_CHUNK && !fill(QOI_MAX_CHUNK) && !chunkAvailable())
+			{
+				std::cout << "Error qoiDecoder 1: data ends before the image is complete" << std::endl;
+				return false;
+			}
+			const uint8_t* p = _pBuf + _pos;
+			uint8_t b1 = p[0];
+			if (b1 == QOI_OP_RGB) {
+				px.r = p[1]; px.g = p[2]; px.b = p[3];
+				_pos += 4;
+			} else if (b1 == QOI_OP_RGBA) {
+				px.r = p[1]; px.g = p[2]; px.b = p[3]; px.a = p[4];
+				_pos += 5;
+			} else if ((b1 & QOI_MASK_2) == QOI_OP_INDEX) {
+				px = _index[b1];
+				_pos += 1;
+			} else if ((b1 & QOI_MASK_2) == QOI_OP_DIFF) {
+				px.r += ((b1 >> 4) & 0x03) - 2;
+				px.g += ((b1 >> 2) & 0x03) - 2;
+				px.b += (b1 & 0x03) - 2;
+				_pos += 1;
+			} else if ((b1 & QOI_MASK_2) == QOI_OP_LUMA) {
+				int8_t dg = (b1 & 0x3F) - 32;
+				px.r += dg - 8 + ((p[1] >> 4) & 0x0F);
+				px.g += dg;
+				px.b += dg - 8 + (p[1] & 0x0F);
+				_pos += 2;
+			} else {
+				_run = b1 & 0x3F;
+				_pos += 1;
+			}
+			_index[QOIHash(px.r, px.g, px.b, px.a)] = px;
+			hi = (px.r & 0xF8) | (px.g >> 5);
+			lo = ((px.g & 0x1C) << 3) | (px.b >> 3);
+		}
+		if (pDst != nullptr && col >= x && col < keepEnd)
+		{
+			*pDst++ = hi;
+			*pDst++ = lo;
+		}
+	}
+	_px = px;
+	_row++;
+	return true;
+}
+
+/*!
+	@brief Check the whole of the chunk at _pos is in the buffer, used near the end of the data
+	@return true if the chunk can be decoded
+*/
+bool qoiDecoder::chunkAvailable(void) const
+{
+	size_t avail = _end - _pos;
+	if (avail < 1) return false;
+	uint8_t b1 = _pBuf[_pos];
+	size_t need = 1;
+	if (b1 == QOI_OP_RGB) need = 4;
+	else if (b1 == QOI_OP_RGBA) need = 5;
+	else if ((b1 & QOI_MASK_2) == QOI_OP_LUMA) need = 2;
+	return avail >= need;
+}
+
+/*!
+	@brief Try to have at least bytes available at _pos, reading the file if needed
+	@param bytes number of bytes wanted, at most RVL_QOI_READ_BUFFER_SIZE
+	@return true if available. At the end of the data fewer may be left, the
+		caller checks what it really needs.
+*/
+bool qoiDecoder::fill(size_t bytes)
+{
+	if (_end - _pos >= bytes) return true;
+	if (_pFile != nullptr && !_eof)
+	{
+		size_t keep = _end - _pos;
+		memmove(_readBuffer, _readBuffer + _pos, keep);
+		_pos = 0;
+		size_t got = fread(_readBuffer + keep, 1, RVL_QOI_READ_BUFFER_SIZE - keep, _pFile);
+		_end = keep + got;
+		if (got < RVL_QOI_READ_BUFFER_SIZE - keep) _eof = true;
+	}
+	return _end - _pos >= bytes;
+}
+
+// **************** EOF *****************
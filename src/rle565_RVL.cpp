@@ -0,0 +1,269 @@
+/*!
+	@file     rle565_RVL.cpp
+	@author   Gavin Lyons
+	@brief    Run length encoded RGB565 image format, encoder and streaming decoder.
+				Project Name: ST7789_TFT_RPI
+*/
+
+#include <iostream>
+#include <cstring>
+#include "../include/rle565_RVL.hpp"
+
+static_assert(sizeof(rvlRLE565_Header_t) == RVL_RLE565_HEADER_SIZE, "RLE565 header layout");
+
+/*!
+	@brief Append one packet header to an encoded image
+	@param out encoded image
+	@param run true for a run, false for a literal
+	@param count pixels in packet, 1 to RVL_RLE565_MAX_COUNT
+*/
+static void PutPacketHeader(std::vector<uint8_t>& out, bool run, uint32_t count)
+{
+	uint8_t flag = run ? 0x80 : 0x00;
+	if (count <= 127)
+	{
+		out.push_back(flag | (count - 1));
+	} else {
+		out.push_back(flag | 0x7F);
+		out.push_back((count - 128) & 0xFF);
+		out.push_back((count - 128) >> 8);
+	}
+}
+
+/*!
+	@brief Encode an image to RLE565
+	@param pPixels big endian RGB565 pixels, rows top down
+	@param w width in pixels
+	@param h height in pixels
+	@param out receives header and packets, replaced
+	@note Runs of 2 or more start a run packet, inside a literal a run must
+		be 3 or more to be worth ending the literal.
+*/
+void RLE565Encode(const uint8_t* pPixels, uint16_t w, uint16_t h, std::vector<uint8_t>& out)
+{
+	out.clear();
+	rvlRLE565_Header_t header;
+	memcpy(header.magic, RVL_RLE565_MAGIC, 4);
+	header.width = w;
+	header.height = h;
+	out.insert(out.end(), (const uint8_t*)&header, (const uint8_t*)&header + sizeof(header));
+
+	const uint32_t total = (uint32_t)w * h;
+	auto pixelAt = [pPixels](uint32_t i) { return (uint16_t)((pPixels[i * 2] << 8) | pPixels[i * 2 + 1]); };
+	auto runLength = [&](uint32_t i) {
+		uint32_t n = 1;
+		while (i + n < total && n < RVL_RLE565_MAX_COUNT && pixelAt(i + n) == pixelAt(i)) n++;
+		return n;
+	};
+	uint32_t i = 0;
+	while (i < total)
+	{
+		uint32_t run = runLength(i);
+		if (run >= 2)
+		{
+			PutPacketHeader(out, true, run);
+			out.push_back(pPixels[i * 2]);
+			out.push_back(pPixels[i * 2 + 1]);
+			i += run;
+			continue;
+		}
+		// Literal, up to the next run of 3 or more
+		uint32_t start = i++;
+		while (i < total && i - start < RVL_RLE565_MAX_COUNT)
+		{
+			if (i + 2 < total && pixelAt(i) == pixelAt(i + 1) && pixelAt(i) == pixelAt(i + 2)) break;
+			i++;
+		}
+		PutPacketHeader(out, false, i - start);
+		out.insert(out.end(), pPixels + start * 2, pPixels + i * 2);
+	}
+}
+
+/*!
+	@brief Destructor, closes any open file
+*/
+rle565Decoder::~rle565Decoder()
+{
+	close();
+}
+
+/*!
+	@brief Open an RLE565 image file
+	@param path file system path of the image
+	@return enum rvlDisplay_Return_Codes_e
+		-# rvlDisplay_Success for success
+		-# rvlDisplay_FileOpen file could not be opened
+		-# rvlDisplay_FileFormat not an RLE565 image
+	@note The file is read a buffer at a time as the image is decoded.
+*/
+rvlDisplay_Return_Codes_e rle565Decoder::open(const char* path)
+{
+	close();
+	if (path == nullptr || (_pFile = fopen(path, "rb")) == nullptr)
+	{
+		std::cout << "Error rle565Decoder open 1: File could not be opened : " << (path ? path : "nullptr") << std::endl;
+		return rvlDisplay_FileOpen;
+	}
+	_pBuf = _readBuffer;
+	return readHeader();
+}
+
+/*!
+	@brief Open an RLE565 image held in memory
+	@param pData image data, must stay valid while the decoder is used
+	@param len bytes of image data
+	@return enum rvlDisplay_Return_Codes_e
+		-# rvlDisplay_Success for success
+		-# rvlDisplay_BitmapNullptr pData is nullptr
+		-# rvlDisplay_FileFormat not an RLE565 image
+	@note Literal pixels are returned straight from pData, no copy.
+*/
+rvlDisplay_Return_Codes_e rle565Decoder::open(const uint8_t* pData, size_t len)
+{
+	close();
+	if (pData == nullptr)
+	{
+		std::cout << "Error rle565Decoder open 2: data is nullptr" << std::endl;
+		return rvlDisplay_BitmapNullptr;
+	}
+	_pBuf = pData;
+	_end = len;
+	return readHeader();
+}
+
+/*!
+	@brief Close any open file
+*/
+void rle565Decoder::close(void)
+{
+	if (_pFile != nullptr)
+	{
+		fclose(_pFile);
+		_pFile = nullptr;
+	}
+	_pBuf = nullptr;
+	_pos = _end = 0;
+	_pixelsLeft = _literalLeft = 0;
+	_width = _height = 0;
+	_status = rvlDisplay_Success;
+}
+
+/*!
+	@brief Go back to the first pixel to decode the image again
+	@return enum rvlDisplay_Return_Codes_e, see open
+*/
+rvlDisplay_Return_Codes_e rle565Decoder::rewind(void)
+{
+	if (_pBuf == nullptr) return rvlDisplay_BitmapNullptr;
+	if (_pFile != nullptr)
+	{
+		_end = 0;
+		if (fseek(_pFile, 0, SEEK_SET) != 0) return rvlDisplay_FileRead;
+	}
+	_pos = 0;
+	return readHeader();
+}
+
+/*!
+	@brief Get the next run or block of literal pixels
+	@param segment receives the run color or literal pixels and count
+	@return true if a segment was returned, false at the end of the image or on
+		an error, see status()
+	@note A literal packet may come back as several segments when it crosses
+		the end of the file read buffer.
+*/
+bool rle565Decoder::next(rvlRLE565_Segment_t& segment)
+{
+	if (_status != rvlDisplay_Success) return false;
+	if (_literalLeft == 0)
+	{
+		if (_pixelsLeft == 0) return false;
+		if (!fill(1)) return false;
+		uint8_t control = _pBuf[_pos];
+		uint32_t count = (control & 0x7F) + 1;
+		if (count == 128)
+		{
+			if (!fill(3)) return false;
+			count = 128 + (_pBuf[_pos + 1] | (_pBuf[_pos + 2] << 8));
+			_pos += 2;
+		}
+		_pos++;
+		if (count > _pixelsLeft)
+		{
+			std::cout << "Error rle565Decoder next 1: packet runs past end of image" << std::endl;
+			_status = rvlDisplay_FileFormat;
+			return false;
+		}
+		_pixelsLeft -= count;
+		if (control & 0x80)
+		{
+			if (!fill(2)) return false;
+			segment.run = true;
+			segment.color = (_pBuf[_pos] << 8) | _pBuf[_pos + 1];
+			segment.count = count;
+			_pos += 2;
+			return true;
+		}
+		_literalLeft = count;
+	}
+	if (!fill(2)) return false;
+	uint32_t available = (_end - _pos) / 2;
+	segment.run = false;
+	segment.pixels = _pBuf + _pos;
+	segment.count = (_literalLeft < available) ? _literalLeft : available;
+	_literalLeft -= segment.count;
+	_pos += segment.count * 2;
+	return true;
+}
+
+/*!
+	@brief Read and check the header at the start of the data
+	@return enum rvlDisplay_Return_Codes_e, see open
+*/
+rvlDisplay_Return_Codes_e rle565Decoder::readHeader(void)
+{
+	rvlRLE565_Header_t header;
+	if (!fill(sizeof(header)))
+	{
+		std::cout << "Error rle565Decoder open 3: Not an RLE565 image" << std::endl;
+		close();
+		return rvlDisplay_FileFormat;
+	}
+	memcpy(&header, _pBuf + _pos, sizeof(header));
+	if (memcmp(header.magic, RVL_RLE565_MAGIC, 4) != 0)
+	{
+		std::cout << "Error rle565Decoder open 3: Not an RLE565 image" << std::endl;
+		close();
+		return rvlDisplay_FileFormat;
+	}
+	_pos += sizeof(header);
+	_width = header.width;
+	_height = header.height;
+	_pixelsLeft = (uint32_t)_width * _height;
+	_literalLeft = 0;
+	_status = rvlDisplay_Success;
+	return rvlDisplay_Success;
+}
+
+/*!
+	@brief Make sure at least bytes are available at _pos, reading the file if needed
+	@param bytes number of bytes needed, at most RVL_RLE565_READ_BUFFER_SIZE
+	@return true if available, false and status set if the data ends first
+*/
+bool rle565Decoder::fill(size_t bytes)
+{
+	if (_end - _pos >= bytes) return true;
+	if (_pFile != nullptr)
+	{
+		size_t keep = _end - _pos;
+		memmove(_readBuffer, _readBuffer + _pos, keep);
+		_pos = 0;
+		_end = keep + fread(_readBuffer + keep, 1, RVL_RLE565_READ_BUFFER_SIZE - keep, _pFile);
+		if (_end >= bytes) return true;
+	}
+	std::cout << "Error rle565Decoder 1: data ends before the image is complete" << std::endl;
+	_status = rvlDisplay_FileRead;
+	return false;
+}
+
+// **************** EOF *****************
@@ -0,0 +1,374 @@
+/*!
+	@file     text_grid_RVL.cpp
+	@author   Gavin Lyons
+	@brief    Grid of character cells in a fixed width font, redraws only the cells that changed.
+				Project Name: ST7789_TFT_RPI
+*/
+
+#include <cmath>
+#include "../include/text_grid_RVL.hpp"
+
+/*!
+	@brief Constructor, every cell starts as a space in white on black
+	@param display display the grid is drawn on
+	@param x grid top left position on x-axis
+	@param y grid top left position on y-axis
+	@param cols cells across
+	@param rows cells down
+	@param font fixed width font of the grid, proportional fonts are not supported
+	@param scale text scale of the grid, see setTextScale
+	@note The grid only draws on update, the first update draws every cell.
+*/
+textGrid::textGrid(color16_graphics& display, int16_t x, int16_t y, uint8_t cols, uint8_t rows,
+	display_Font_name_e font, uint8_t scale) :
+	_display(display), _x(x), _y(y), _cols(cols), _rows(rows), _font(font), _scale(scale),
+	_cells((size_t)cols * rows), _drawn((size_t)cols * rows)
+{
+	if (_font >= font_default && _font <= font_sixteenSeg)
+		_spaceInFont = (' ' >= rvlFontInfo[_font - 1].offset);
+}
+
+/*!
+	@brief Set the colors of cells staged by setCell, print and clear
+	@param color foreground color
+	@param bgcolor background color
+*/
+void textGrid::setColor(uint16_t color, uint16_t bgcolor)
+{
+	_color = color;
+	_bgcolor = bgcolor;
+}
+
+/*!
+	@brief Stage one cell, drawn on the next update if it changed
+	@param col cell column, 0 is left
+	@param row cell row, 0 is top
+	@param value character, in the grid font's range, or a space in any font
+	@return Will return rvlDisplay_Return_Codes_e enum
+		-# rvlDisplay_Success  success
+		-# rvlDisplay_CharScreenBounds cell is outside the grid
+		-# rvlDisplay_WrongFont grid font is not a fixed width font
+		-# rvlDisplay_CharFontASCIIRange character out of font range, or a new line
+*/
+rvlDisplay_Return_Codes_e textGrid::setCell(uint8_t col, uint8_t row, char value)
+{
+	if (col >= _cols || row >= _rows)
+	{
+		std::cout << "textGrid setCell Error 1: cell outside grid" << std::endl;
+		return rvlDisplay_CharScreenBounds;
+	}
+	if (_font < font_default || _font > font_sixteenSeg)
+	{
+		std::cout << "textGrid setCell Error 2: grid font must be fixed width" << std::endl;
+		return rvlDisplay_WrongFont;
+	}
+	const rvlFontInfo_t& info = rvlFontInfo[_font - 1];
+	const bool inFont = value >= info.offset && value < (info.offset + info.numChars + 1);
+	if (value == '\n' || value == '\r' || (!inFont && value != ' '))
+	{
+		std::cout << "textGrid setCell Error 3: Character out of Font bounds " << value << std::endl;
+		return rvlDisplay_CharFontASCIIRange;
+	}
+	rvlTextCell_t& cell = _cells[(size_t)row * _cols + col];
+	cell.value = value;
+	cell.color = _color;
+	cell.bgcolor = _bgcolor;
+	return rvlDisplay_Success;
+}
+
+/*!
+	@brief Stage a text into the cells of one row, from a column to the end of the row
+	@param col first cell column
+	@param row cell row
+	@param pText null terminated text, characters past the end of the row are dropped
+	@return Will return rvlDisplay_Return_Codes_e enum
+		-# rvlDisplay_Success  success
+		-# rvlDisplay_CharArrayNullptr  pText invalid pointer object
+		-# Failure in setCell
+*/
+rvlDisplay_Return_Codes_e textGrid::print(uint8_t col, uint8_t row, const char* pText)
+{
+	if (pText == nullptr)
+	{
+		std::cout << "textGrid print Error 1: String array is not valid pointer" << std::endl;
+		return rvlDisplay_CharArrayNullptr;
+	}
+	for (; *pText != '\0' && col < _cols; pText++, col++)
+	{
+		rvlDisplay_Return_Codes_e returnCode = setCell(col, row, *pText);
+		if (returnCode != rvlDisplay_Success) return returnCode;
+	}
+	return rvlDisplay_Success;
+}
+
+/*!
+	@brief Stage every cell as a space in the current colors
+*/
+void textGrid::clear(void)
+{
+	for (rvlTextCell_t& cell : _cells)
+	{
+		cell.value = ' ';
+		cell.color = _color;
+		cell.bgcolor = _bgcolor;
+	}
+}
+
+/*!
+	@brief Draw the cells which differ from what was last drawn
+	@return Will return rvlDisplay_Return_Codes_e enum
+		-# rvlDisplay_Success  success
+		-# rvlDisplay_WrongFont grid font is not a fixed width font
+		-# Failure in setFont or the text drawing upstream
+	@details Neighbouring changed cells in a row with the same colors are sent
+		as one run, one address window, see getRunsDrawn. Unchanged cells are
+		not sent. Spaces in a font with no space, the segment fonts, are
+		filled with the background color. Draws opaque in the grid font at the
+		grid scale. The display's font, font inversion, text scale, transparency,
+		text colors and cursor are restored after.
+*/
+rvlDisplay_Return_Codes_e textGrid::update(void)
+{
+	_cellsDrawn = 0;
+	_runsDrawn = 0;
+	if (_font < font_default || _font > font_sixteenSeg)
+	{
+		std::cout << "textGrid update Error 1: grid font must be fixed width" << std::endl;
+		return rvlDisplay_WrongFont;
+	}
+	// Text state of the display, put back when done
+	const display_Font_name_e oldFont = _display.getFont();
+	const rvlPropFont_t* oldPropFont = _display.getPropFont();
+	const bool oldInvert = _display.getInvertFont();
+	const uint8_t oldScale = _display.getTextScale();
+	const bool oldTransparent = _display.getTextTransparent();
+	const uint16_t oldColor = _display.getTextColor(), oldBgColor = _display.getTextBgColor();
+	const int16_t oldCursorX = _display.getCursorX(), oldCursorY = _display.getCursorY();
+	rvlDisplay_Return_Codes_e returnCode = _display.setFont(_font);
+	if (returnCode == rvlDisplay_Success) returnCode = _display.setTextScale(_scale);
+	_display.setTextTransparent(false);
+
+	const uint16_t cellW = cellWidth(), cellH = cellHeight();
+	char run[256];
+	for (uint8_t row = 0; row < _rows && returnCode == rvlDisplay_Success; row++)
+	{
+		rvlTextCell_t* pCells = &_cells[(size_t)row * _cols];
+		rvlTextCell_t* pDrawn = &_drawn[(size_t)row * _cols];
+		uint8_t col = 0;
+		while (col < _cols)
+		{
+			if (!_redrawAll && pCells[col] == pDrawn[col]) { col++; continue; }
+			// Extend the run over changed cells of the same colors, and all glyphs or all fills
+			const uint8_t start = col;
+			const bool fill = !_spaceInFont && pCells[start].value == ' ';
+			uint8_t count = 0;
+			while (col < _cols && (_redrawAll || pCells[col] != pDrawn[col]) &&
+				pCells[col].color == pCells[start].color && pCells[col].bgcolor == pCells[start].bgcolor &&
+				(!_spaceInFont && pCells[col].value == ' ') == fill)
+			{
+				run[count++] = pCells[col].value;
+				col++;
+			}
+			if (fill)
+			{
+				_display.fillRect(_x + start * cellW, _y + row * cellH, count * cellW, cellH, pCells[start].bgcolor);
+			} else {
+				_display.setTextColor(pCells[start].color, pCells[start].bgcolor);
+				_display.setCursor(_x + start * cellW, _y + row * cellH);
+				if (_display.write((const uint8_t*)run, count) != count)
+				{
+					returnCode = rvlDisplay_CharScreenBounds;
+					break;
+				}
+			}
+			// Only a run that reached the display counts as drawn
+			for (uint8_t k = start; k < col; k++) pDrawn[k] = pCells[k];
+			_cellsDrawn += count;
+			_runsDrawn++;
+		}
+	}
+	if (returnCode == rvlDisplay_Success) _redrawAll = false;
+	if (oldPropFont != nullptr)
+		_display.setFont(oldPropFont);
+	else
+		_display.setFont(oldFont);
+	_display.setInvertFont(oldInvert);
+	_display.setTextScale(oldScale);
+	_display.setTextTransparent(oldTransparent);
+	_display.setTextColor(oldColor, oldBgColor);
+	_display.setCursor(oldCursorX, oldCursorY);
+	return returnCode;
+}
+
+/*!
+	@brief Draw every cell on the next update, for when the grid area was drawn over
+*/
+void textGrid::invalidate(void)
+{
+	_redrawAll = true;
+}
+
+/*!
+	@brief Width of a cell in pixels, the font width times the grid scale
+	@return cell width, 0 if the grid font is not a fixed width font
+*/
+uint16_t textGrid::cellWidth(void) const
+{
+	if (_font < font_default || _font > font_sixteenSeg) return 0;
+	return rvlFontInfo[_font - 1].width * _scale;
+}
+
+/*!
+	@brief Height of a cell in pixels, the font height times the grid scale
+	@return cell height, 0 if the grid font is not a fixed width font
+*/
+uint16_t textGrid::cellHeight(void) const
+{
+	if (_font < font_default || _font > font_sixteenSeg) return 0;
+	return rvlFontInfo[_font - 1].height * _scale;
+}
+
+/*!
+	@brief Cells sent by the last update
+	@return number of cells
+*/
+uint32_t textGrid::getCellsDrawn(void) const
+{
+	return _cellsDrawn;
+}
+
+/*!
+	@brief Runs of cells sent by the last update, one address window each
+	@return number of runs
+*/
+uint32_t textGrid::getRunsDrawn(void) const
+{
+	return _runsDrawn;
+}
+
+// === numericField ===
+
+/*!
+	@brief Constructor
+	@param display display the field is drawn on
+	@param x field top left position on x-axis
+	@param y field top left position on y-axis
+	@param width field width in characters, including any sign and decimal point
+	@param font fixed width font, it must have the digits, '-' and '.'
+	@param align number aligned to the left or right of the field
+	@param scale text scale of the field, see setTextScale
+	@note Nothing is drawn until the first value is set.
+*/
+numericField::numericField(color16_graphics& display, int16_t x, int16_t y, uint8_t width,
+	display_Font_name_e font, rvlFieldAlign_e align, uint8_t scale) :
+	_grid(display, x, y, width, 1, font, scale), _width(width), _align(align)
+{
+}
+
+/*!
+	@brief Set the colors of the field, all cells are sent on the next value
+	@param color foreground color
+	@param bgcolor background color
+*/
+void numericField::setColor(uint16_t color, uint16_t bgcolor)
+{
+	_grid.setColor(color, bgcolor);
+}
+
+/*!
+	@brief Show an integer
+	@param value the number
+	@return Will return rvlDisplay_Return_Codes_e enum
+		-# rvlDisplay_Success  success
+		-# rvlDisplay_CharScreenBounds number is wider than the field, nothing is drawn
+		-# Failure in textGrid::print or textGrid::update
+*/
+rvlDisplay_Return_Codes_e numericField::setValue(int32_t value)
+{
+	return setFixed(value, 0);
+}
+
+/*!
+	@brief Show a floating point number rounded to a number of decimal places
+	@param value the number
+	@param decimals digits after the decimal point, 0 to 9
+	@return as setFixed
+*/
+rvlDisplay_Return_Codes_e numericField::setValue(double value, uint8_t decimals)
+{
+	if (decimals > 9) decimals = 9;
+	const double scaled = std::round(value * std::pow(10.0, decimals));
+	if (!(scaled >= INT32_MIN && scaled <= INT32_MAX))
+	{
+		std::cout << "numericField setValue Error 1: value too wide for field" << std::endl;
+		return rvlDisplay_CharScreenBounds;
+	}
+	return setFixed((int32_t)scaled, decimals);
+}
+
+/*!
+	@brief Show a fixed point number, value / 10^decimals
+	@param value the number times 10^decimals, e.g. 2355 and 2 shows 23.55
+	@param decimals digits after the decimal point, 0 to 9
+	@return Will return rvlDisplay_Return_Codes_e enum
+		-# rvlDisplay_Success  success
+		-# rvlDisplay_CharScreenBounds number is wider than the field, nothing is drawn
+		-# Failure in textGrid::print or textGrid::update
+	@details The text is diffed against the field's cells, only the cells
+		which changed are sent, cells the old number used and the new one
+		does not are cleared. No floating point is used.
+*/
+rvlDisplay_Return_Codes_e numericField::setFixed(int32_t value, uint8_t decimals)
+{
+	if (decimals > 9) decimals = 9;
+	const uint32_t magnitude = (value < 0) ? 0U - (uint32_t)value : (uint32_t)value;
+	uint32_t divisor = 1;
+	for (uint8_t i = 0; i < decimals; i++) divisor *= 10;
+	char text[24];
+	int length;
+	if (decimals == 0)
+		length = snprintf(text, sizeof(text), "%s%lu", (value < 0) ? "-" : "", (unsigned long)magnitude);
+	else
+		length = snprintf(text, sizeof(text), "%s%lu.%0*lu", (value < 0) ? "-" : "",
+			(unsigned long)(magnitude / divisor), decimals, (unsigned long)(magnitude % divisor));
+	return show(text, length);
+}
+
+/*!
+	@brief Send every cell on the next value, for when the field was drawn over
+*/
+void numericField::invalidate(void)
+{
+	_grid.invalidate();
+}
+
+/*!
+	@brief Cells sent by the last value
+	@return number of cells, 1 for a count going up by one in the common case
+*/
+uint32_t numericField::getCellsDrawn(void) const
+{
+	return _grid.getCellsDrawn();
+}
+
+/*!
+	@brief Stage the text aligned in blank cells and draw the changes
+	@param pText the number as text
+	@param length characters in pText
+	@return enum rvlDisplay_Return_Codes_e from textGrid
+*/
+rvlDisplay_Return_Codes_e numericField::show(const char* pText, size_t length)
+{
+	if (length > _width)
+	{
+		std::cout << "numericField Error 2: value too wide for field " << pText << std::endl;
+		return rvlDisplay_CharScreenBounds;
+	}
+	_grid.clear();
+	const uint8_t start = (_align == rvlFieldAlign_Right) ? _width - length : 0;
+	rvlDisplay_Return_Codes_e returnCode = _grid.print(start, 0, pText);
+	if (returnCode != rvlDisplay_Success) return returnCode;
+	return _grid.update();
+}
+
+// **************** EOF *****************
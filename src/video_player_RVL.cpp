@@ -0,0 +1,256 @@
+/*!
+	@file     video_player_RVL.cpp
+	@author   Gavin Lyons
+	@brief    Player for raw big endian RGB565 video from a file descriptor.
+				Project Name: ST7789_TFT_RPI
+*/
+
+#include <iostream>
+#include <cstdlib>
+#include <cerrno>
+#include <chrono>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <poll.h>
+#include <unistd.h>
+#include "../include/video_player_RVL.hpp"
+
+#define RVL_VIDEO_BUFFERS 2         /**< Frame buffers shared by the reader thread and the player */
+#define RVL_VIDEO_POLL_TIMEOUT 100  /**< mS the reader waits for input before checking for stop */
+
+typedef std::chrono::steady_clock rvlVideoClock;
+
+static inline uint64_t NowMicros(void)
+{
+	return std::chrono::duration_cast<std::chrono::microseconds>(
+		rvlVideoClock::now().time_since_epoch()).count();
+}
+
+// === rvlRecordingSink ===
+
+/*!
+	@brief Constructor for rvlRecordingSink
+	@param busTimeUs time each writeFrame takes, microseconds, to act like a display bus
+*/
+rvlRecordingSink::rvlRecordingSink(uint32_t busTimeUs) : _busTimeUs(busTimeUs) {}
+
+/*!
+	@brief Record a frame, its size, hash and arrival time
+	@param pFrame big endian RGB565 pixels
+	@param w frame width in pixels
+	@param h frame height in pixels
+	@return rvlDisplay_Success
+*/
+rvlDisplay_Return_Codes_e rvlRecordingSink::writeFrame(const uint8_t* pFrame, uint16_t w, uint16_t h)
+{
+	rvlRecordedFrame_t frame;
+	frame.bytes = (uint32_t)w * h * 2;
+	frame.timeUs = NowMicros();
+	uint32_t hash = 2166136261u;
+	for (uint32_t i = 0; i < frame.bytes; i++)
+		hash = (hash ^ pFrame[i]) * 16777619u;
+	frame.hash = hash;
+	_frames.push_back(frame);
+	if (_busTimeUs)
+		std::this_thread::sleep_until(rvlVideoClock::now() + std::chrono::microseconds(_busTimeUs));
+	return rvlDisplay_Success;
+}
+
+// === videoPlayer ===
+
+/*! @brief Frame buffers and their state, shared by play and the reader thread */
+struct rvlVideoShared_t
+{
+	std::mutex lock;                /**< Guards everything below */
+	std::condition_variable change; /**< Signalled when a buffer fills or empties */
+	uint8_t* buffers[RVL_VIDEO_BUFFERS] = {}; /**< Frame buffers */
+	bool full[RVL_VIDEO_BUFFERS] = {};        /**< Buffer holds a frame not yet used */
+	uint64_t readyUs[RVL_VIDEO_BUFFERS] = {}; /**< Time each frame was read, microseconds */
+	bool end = false;               /**< Reader has finished, end of input, error or stop */
+};
+
+/*!
+	@brief Constructor for videoPlayer
+	@param w frame width in pixels
+	@param h frame height in pixels
+*/
+videoPlayer::videoPlayer(uint16_t w, uint16_t h) :
+	_width(w), _height(h), _frameBytes((uint32_t)w * h * 2) {}
+
+/*!
+	@brief Ask a running play to finish, safe to call from another thread or a signal handler
+*/
+void videoPlayer::stop(void)
+{
+	_stop = true;
+}
+
+/*!
+	@brief Read one whole frame, waiting for pipes until it arrives or stop is called
+	@param fd file descriptor to read
+	@param pDst receives frameBytes bytes
+	@return true for a whole frame, false at end of input, on error or stop
+*/
+bool videoPlayer::readFrame(int fd, uint8_t* pDst)
+{
+	uint32_t got = 0;
+	while (got < _frameBytes)
+	{
+		if (_stop) return false;
+		struct pollfd pfd = {fd, POLLIN, 0};
+		int ready = poll(&pfd, 1, RVL_VIDEO_POLL_TIMEOUT);
+		if (ready == 0 || (ready < 0 && errno == EINTR)) continue;
+		if (ready < 0)
+		{
+			std::cout << "Error readFrame 1: poll failed " << errno << std::endl;
+			return false;
+		}
+		ssize_t n = read(fd, pDst + got, _frameBytes - got);
+		if (n < 0 && (errno == EINTR || errno == EAGAIN)) continue;
+		if (n < 0)
+		{
+			std::cout << "Error readFrame 2: read failed " << errno << std::endl;
+			return false;
+		}
+		if (n == 0)
+		{
+			if (got) std::cout << "Error readFrame 3: partial frame at end of input, " << got << " bytes" << std::endl;
+			return false;
+		}
+		got += (uint32_t)n;
+	}
+	return true;
+}
+
+/*!
+	@brief Play frames from a file descriptor until end of input, maxFrames or stop
+	@param fd file descriptor of a file, pipe or stdin (0)
+	@param sink destination of the frames
+	@param fps target frame rate, 0 to send frames as fast as the sink takes them
+	@param maxFrames stop after reading this many frames, 0 for no limit
+	@return
+		-# rvlDisplay_Success
+		-# rvlDisplay_BitmapSize frame size of zero
+		-# rvlDisplay_MallocError
+		-# error returned by the sink
+	@details A reader thread reads frames into two buffers while the other is sent.
+		Frame n is due at n / fps seconds after the first frame. A frame still not sent
+		a full frame period after it is due is dropped, so a slow bus skips frames
+		rather than falling further behind. Statistics are available from getStats.
+*/
+rvlDisplay_Return_Codes_e videoPlayer::play(int fd, rvlFrameSink& sink, float fps, uint32_t maxFrames)
+{
+	_stats = rvlVideo_Stats_t();
+	_stop = false;
+	if (_frameBytes == 0)
+	{
+		std::cout << "Error play 1: frame size is zero" << std::endl;
+		return rvlDisplay_BitmapSize;
+	}
+	rvlVideoShared_t shared;
+	for (uint8_t i = 0; i < RVL_VIDEO_BUFFERS; i++)
+	{
+		shared.buffers[i] = (uint8_t*)malloc(_frameBytes);
+		if (shared.buffers[i] == nullptr)
+		{
+			std::cout << "Error play 2: could not allocate frame buffers" << std::endl;
+			for (uint8_t j = 0; j < i; j++) free(shared.buffers[j]);
+			return rvlDisplay_MallocError;
+		}
+	}
+
+	// 1. Reader thread, fills the buffers in turn
+	std::thread reader([&]() {
+		uint32_t count = 0;
+		for (uint8_t slot = 0; ; slot = (slot + 1) % RVL_VIDEO_BUFFERS)
+		{
+			{
+				std::unique_lock<std::mutex> guard(shared.lock);
+				shared.change.wait(guard, [&]{ return !shared.full[slot] || _stop; });
+			}
+			bool ok = (maxFrames == 0 || count < maxFrames) && readFrame(fd, shared.buffers[slot]);
+			std::lock_guard<std::mutex> guard(shared.lock);
+			if (!ok || _stop)
+			{
+				shared.end = true;
+				shared.change.notify_all();
+				return;
+			}
+			count++;
+			shared.full[slot] = true;
+			shared.readyUs[slot] = NowMicros();
+			shared.change.notify_all();
+		}
+	});
+
+	// 2. Send the frames in order, paced, dropping late ones
+	const uint64_t periodUs = (fps > 0.0f) ? (uint64_t)(1000000.0f / fps) : 0;
+	rvlDisplay_Return_Codes_e result = rvlDisplay_Success;
+	uint64_t startUs = 0, firstUs = 0, lastUs = 0, latencySum = 0;
+	uint32_t latencyMin = UINT32_MAX, latencyMax = 0;
+	for (uint8_t slot = 0; ; slot = (slot + 1) % RVL_VIDEO_BUFFERS)
+	{
+		uint64_t readyUs;
+		{
+			std::unique_lock<std::mutex> guard(shared.lock);
+			shared.change.wait(guard, [&]{ return shared.full[slot] || shared.end; });
+			if (!shared.full[slot]) break;
+			readyUs = shared.readyUs[slot];
+		}
+		uint32_t n = _stats.framesRead++;
+		uint64_t nowUs = NowMicros();
+		if (n == 0) startUs = nowUs;
+		uint64_t dueUs = startUs + n * periodUs;
+
+		if (periodUs && nowUs > dueUs + periodUs)
+		{
+			_stats.framesDropped++;
+		} else {
+			if (nowUs < dueUs)
+				std::this_thread::sleep_until(rvlVideoClock::time_point(std::chrono::microseconds(dueUs)));
+			result = sink.writeFrame(shared.buffers[slot], _width, _height);
+			lastUs = NowMicros();
+			if (_stats.framesShown == 0) firstUs = lastUs;
+			uint32_t latency = (uint32_t)(lastUs - readyUs);
+			latencySum += latency;
+			if (latency < latencyMin) latencyMin = latency;
+			if (latency > latencyMax) latencyMax = latency;
+			_stats.framesShown++;
+		}
+		{
+			std::lock_guard<std::mutex> guard(shared.lock);
+			shared.full[slot] = false;
+			shared.change.notify_all();
+		}
+		if (result != rvlDisplay_Success)
+		{
+			std::cout << "Error play 3: frame sink failed " << +result << std::endl;
+			_stop = true;
+			break;
+		}
+	}
+	{
+		// wake the reader if it is waiting on a full buffer
+		std::lock_guard<std::mutex> guard(shared.lock);
+		_stop = true;
+		shared.change.notify_all();
+	}
+	reader.join();
+	for (uint8_t i = 0; i < RVL_VIDEO_BUFFERS; i++) free(shared.buffers[i]);
+
+	// 3. Statistics
+	if (_stats.framesShown)
+	{
+		// rate over the intervals between frames, first sent to last sent
+		_stats.elapsedUs = lastUs - firstUs;
+		if (_stats.elapsedUs)
+			_stats.fps = (float)(_stats.framesShown - 1) * 1000000.0f / (float)_stats.elapsedUs;
+		_stats.latencyMinUs = latencyMin;
+		_stats.latencyMaxUs = latencyMax;
+		_stats.latencyAvgUs = (uint32_t)(latencySum / _stats.framesShown);
+	}
+	return result;
+}
+
+// ********************** EOF *********************
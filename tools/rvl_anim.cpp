@@ -0,0 +1,122 @@
+/*!
+	@file     tools/rvl_anim.cpp
+	@author   Gavin Lyons
+	@brief    Build time tool, builds a delta frame animation from BMP files. Project Name: ST7789_TFT_RPI
+	@details  Usage: rvl_anim <output file> <frame delay mS> <directory or .bmp file> ...
+				The .bmp files in each directory (not recursive) are the frames, in
+				file name order, all the same size. Each frame is diffed against the
+				one before and only the changed rectangles stored, see delta_anim_RVL.hpp.
+				The rectangles and bus bytes of each frame are printed, and the bus
+				bytes of one loop against sending every frame whole.
+				Built by "make tools", runs on the host, does not need the bcm2835 library.
+	@note     Header fields are written in host order, build on a little endian host.
+*/
+
+#include <iostream>
+#include <fstream>
+#include <filesystem>
+#include <vector>
+#include <string>
+#include <algorithm>
+#include "bmp_file_RVL.hpp"
+#include "delta_anim_RVL.hpp"
+
+namespace fs = std::filesystem;
+
+int main(int argc, char* argv[])
+{
+	if (argc < 4)
+	{
+		std::cout << "Usage: " << argv[0] << " <output file> <frame delay mS> <directory or .bmp file> ..." << std::endl;
+		return 1;
+	}
+	std::error_code ec;
+	fs::path outPath = argv[1];
+	const int delay = atoi(argv[2]);
+	if (delay < 0 || delay > 0xFFFF)
+	{
+		std::cout << "Error: frame delay must be 0 to 65535 mS" << std::endl;
+		return 1;
+	}
+
+	// 1. Collect the BMP files
+	std::vector<fs::path> files;
+	for (int i = 3; i < argc; i++)
+	{
+		if (fs::is_directory(argv[i], ec))
+		{
+			std::vector<fs::path> dirFiles;
+			for (const auto& item : fs::directory_iterator(argv[i], ec))
+			{
+				std::string ext = item.path().extension().string();
+				std::transform(ext.begin(), ext.end(), ext.begin(), ::tolower);
+				if (item.is_regular_file() && ext == ".bmp") dirFiles.push_back(item.path());
+			}
+			std::sort(dirFiles.begin(), dirFiles.end());
+			files.insert(files.end(), dirFiles.begin(), dirFiles.end());
+		} else {
+			files.push_back(argv[i]);
+		}
+	}
+	if (files.empty() || files.size() > 0xFFFF)
+	{
+		std::cout << "Error: no BMP files found, or too many" << std::endl;
+		return 2;
+	}
+
+	// 2. Convert each frame to display format
+	bmpReader bmp;
+	std::vector<std::vector<uint8_t>> frames;
+	uint16_t width = 0, height = 0;
+	for (const auto& file : files)
+	{
+		if (bmp.open(file.c_str()) != rvlDisplay_Success) return 3;
+		if (frames.empty())
+		{
+			width = bmp.width();
+			height = bmp.height();
+		} else if (bmp.width() != width || bmp.height() != height) {
+			std::cout << "Error: " << file << " is " << bmp.width() << "x" << bmp.height()
+				<< ", frames must all be " << width << "x" << height << std::endl;
+			return 3;
+		}
+		frames.emplace_back((size_t)width * height * 2);
+		for (uint16_t y = 0; y < height; y++)
+		{
+			if (bmp.readRows(y, 1, 0, width, frames.back().data() + (size_t)y * width * 2) != rvlDisplay_Success)
+				return 3;
+		}
+	}
+
+	// 3. Encode, then read back to report
+	std::vector<const uint8_t*> pFrames;
+	for (const auto& frame : frames) pFrames.push_back(frame.data());
+	std::vector<uint16_t> delays(frames.size(), (uint16_t)delay);
+	std::vector<uint8_t> encoded;
+	DeltaAnimEncode(pFrames.data(), frames.size(), width, height, delays.data(), encoded);
+
+	deltaAnimation anim;
+	if (anim.open(encoded.data(), encoded.size()) != rvlDisplay_Success) return 4;
+	const uint16_t total = anim.frameCount() + (anim.hasLoopFrame() ? 1 : 0);
+	for (uint16_t i = 0; i < total; i++)
+	{
+		const rvlAnimFrame_t* pFrame = anim.frame(i);
+		std::cout << ((i < anim.frameCount()) ? files[i].filename().string() : std::string("loop frame"))
+			<< " : " << pFrame->rectCount << " rects, " << pFrame->busBytes << " bus bytes" << std::endl;
+	}
+	const uint32_t fullBytes = (uint32_t)frames.size() * ((uint32_t)width * height * 2 + RVL_ANIM_WINDOW_BYTES);
+	std::cout << frames.size() << " frames " << width << "x" << height << ", bus bytes per loop "
+		<< anim.loopBusBytes() << ", whole frames " << fullBytes << ", "
+		<< (100ULL * anim.loopBusBytes()) / fullBytes << "%" << std::endl;
+
+	std::ofstream out(outPath, std::ios::binary);
+	out.write((const char*)encoded.data(), encoded.size());
+	out.close();
+	if (!out)
+	{
+		std::cout << "Error: write failed " << outPath << std::endl;
+		return 4;
+	}
+	std::cout << outPath.string() << " : " << encoded.size() << " bytes" << std::endl;
+	return 0;
+}
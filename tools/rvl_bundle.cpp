@@ -0,0 +1,148 @@
+/*!
+	@file     tools/rvl_bundle.cpp
+	@author   Gavin Lyons
+	@brief    Build time tool, packs BMP files into an asset bundle of panel native images.
+				Project Name: ST7789_TFT_RPI
+	@details  Usage: rvl_bundle <output.rvlb> <directory or .bmp file> ...
+				Every .bmp file in each directory (not recursive) is added, the
+				image name is the file name without extension. Built by "make tools",
+				runs on the host, does not need the bcm2835 library.
+	@note     Header fields are written in host order, build on a little endian host.
+*/
+
+#include <iostream>
+#include <fstream>
+#include <filesystem>
+#include <vector>
+#include <string>
+#include <algorithm>
+#include <cstring>
+#include "bmp_file_RVL.hpp"
+#include "asset_bundle_RVL.hpp"
+
+namespace fs = std::filesystem;
+
+/*! @brief One image to be packed */
+struct BundleImage
+{
+	std::string name;          /**< Image name */
+	fs::path path;             /**< Source BMP file */
+	uint16_t width = 0;        /**< Width in pixels */
+	uint16_t height = 0;       /**< Height in pixels */
+};
+
+int main(int argc, char* argv[])
+{
+	if (argc < 3)
+	{
+		std::cout << "Usage: " << argv[0] << " <output.rvlb> <directory or .bmp file> ..." << std::endl;
+		return 1;
+	}
+
+	// 1. Collect the BMP files
+	std::vector<BundleImage> images;
+	for (int i = 2; i < argc; i++)
+	{
+		std::vector<fs::path> files;
+		std::error_code ec;
+		if (fs::is_directory(argv[i], ec))
+		{
+			for (const auto& item : fs::directory_iterator(argv[i], ec))
+			{
+				std::string ext = item.path().extension().string();
+				std::transform(ext.begin(), ext.end(), ext.begin(), ::tolower);
+				if (item.is_regular_file() && ext == ".bmp") files.push_back(item.path());
+			}
+		} else {
+			files.push_back(argv[i]);
+		}
+		for (const auto& file : files)
+		{
+			BundleImage image;
+			image.name = file.stem().string();
+			image.path = file;
+			if (image.name.size() >= RVL_BUNDLE_NAME_SIZE)
+			{
+				std::cout << "Error: name longer than " << RVL_BUNDLE_NAME_SIZE - 1 << " characters : " << file << std::endl;
+				return 2;
+			}
+			images.push_back(image);
+		}
+	}
+	std::sort(images.begin(), images.end(),
+		[](const BundleImage& a, const BundleImage& b) { return a.name < b.name; });
+	for (size_t i = 1; i < images.size(); i++)
+	{
+		if (images[i].name == images[i - 1].name)
+		{
+			std::cout << "Error: duplicate image name : " << images[i].name << std::endl;
+			return 2;
+		}
+	}
+	if (images.empty() || images.size() > UINT16_MAX)
+	{
+		std::cout << "Error: no BMP files found, or too many" << std::endl;
+		return 2;
+	}
+
+	// 2. Read the headers to lay out the index
+	bmpReader bmp;
+	for (auto& image : images)
+	{
+		if (bmp.open(image.path.c_str()) != rvlDisplay_Success) return 3;
+		image.width = bmp.width();
+		image.height = bmp.height();
+	}
+
+	// 3. Write header, index, then image data on 4 byte boundaries
+	std::ofstream out(argv[1], std::ios::binary);
+	if (!out)
+	{
+		std::cout << "Error: could not create " << argv[1] << std::endl;
+		return 4;
+	}
+	rvlBundle_Header_t header{};
+	memcpy(header.magic, RVL_BUNDLE_MAGIC, 4);
+	header.version = RVL_BUNDLE_VERSION;
+	header.count = images.size();
+	out.write((const char*)&header, sizeof(header));
+
+	uint32_t offset = sizeof(header) + images.size() * sizeof(rvlBundle_Entry_t);
+	for (const auto& image : images)
+	{
+		rvlBundle_Entry_t entry{};
+		strncpy(entry.name, image.name.c_str(), RVL_BUNDLE_NAME_SIZE - 1);
+		entry.width = image.width;
+		entry.height = image.height;
+		entry.offset = offset;
+		out.write((const char*)&entry, sizeof(entry));
+		offset += ((uint32_t)image.width * image.height * 2 + 3) & ~3u;
+	}
+
+	uint64_t total = 0;
+	for (const auto& image : images)
+	{
+		// One row at a time, bmpReader returns rows top down in display order
+		std::vector<uint8_t> row(image.width * 2);
+		if (bmp.open(image.path.c_str()) != rvlDisplay_Success) return 3;
+		for (uint16_t y = 0; y < image.height; y++)
+		{
+			if (bmp.readRows(y, 1, 0, image.width, row.data()) != rvlDisplay_Success) return 3;
+			out.write((const char*)row.data(), row.size());
+		}
+		uint32_t bytes = (uint32_t)image.width * image.height * 2;
+		static const char pad[4] = {0, 0, 0, 0};
+		out.write(pad, ((bytes + 3) & ~3u) - bytes);
+		total += bytes;
+		std::cout << image.name << " : " << image.width << "x" << image.height
+			<< " " << +bmp.bitsPerPixel() << " bit" << std::endl;
+	}
+	out.close();
+	if (!out)
+	{
+		std::cout << "Error: write failed " << argv[1] << std::endl;
+		return 4;
+	}
+	std::cout << images.size() << " images, " << total << " bytes of pixel data, written to " << argv[1] << std::endl;
+	return 0;
+}
@@ -0,0 +1,145 @@
+/*!
+	@file     tools/rvl_qoi.cpp
+	@author   Gavin Lyons
+	@brief    Build time tool, encodes BMP files as QOI images. Project Name: ST7789_TFT_RPI
+	@details  Usage: rvl_qoi <output directory> <directory or .bmp file> ...
+				Every .bmp file in each directory (not recursive) is encoded to
+				<output directory>/<name>.qoi and the size saving printed.
+				24 and 32 bit files are encoded from their own pixels, 16 bit
+				files from their 565 pixels widened to 8 bits per channel.
+				Built by "make tools", runs on the host, does not need the bcm2835 library.
+*/
+
+#include <iostream>
+#include <fstream>
+#include <filesystem>
+#include <vector>
+#include <string>
+#include <algorithm>
+#include "bmp_file_RVL.hpp"
+#include "qoi_RVL.hpp"
+
+namespace fs = std::filesystem;
+
+/*!
+	@brief Read the image as 8 bit RGB, rows top down
+	@param bmp open reader
+	@param path file the reader has open
+	@param rgb receives width * height * 3 bytes
+	@return true on success
+*/
+static bool ReadRGB(bmpReader& bmp, const fs::path& path, std::vector<uint8_t>& rgb)
+{
+	const uint16_t w = bmp.width(), h = bmp.height();
+	rgb.resize((size_t)w * h * 3);
+	if (bmp.bitsPerPixel() == 16)
+	{
+		std::vector<uint8_t> row(w * 2);
+		for (uint16_t y = 0; y < h; y++)
+		{
+			if (bmp.readRows(y, 1, 0, w, row.data()) != rvlDisplay_Success) return false;
+			uint8_t* p = rgb.data() + (size_t)y * w * 3;
+			for (uint16_t x = 0; x < w; x++)
+			{
+				uint16_t c = (row[x * 2] << 8) | row[x * 2 + 1];
+				uint8_t r = c >> 11, g = (c >> 5) & 0x3F, b = c & 0x1F;
+				*p++ = (r << 3) | (r >> 2);
+				*p++ = (g << 2) | (g >> 4);
+				*p++ = (b << 3) | (b >> 2);
+			}
+		}
+		return true;
+	}
+	// 24 or 32 bit, BGR(A) stored rows
+	std::ifstream in(path, std::ios::binary);
+	std::vector<uint8_t> row(bmp.stride());
+	const uint8_t bytesPP = bmp.bitsPerPixel() / 8;
+	for (uint16_t y = 0; y < h; y++)
+	{
+		uint32_t stored = bmp.topDown() ? y : (h - 1 - y);
+		in.seekg(bmp.dataOffset() + (std::streamoff)stored * bmp.stride());
+		if (!in.read((char*)row.data(), row.size())) return false;
+		uint8_t* p = rgb.data() + (size_t)y * w * 3;
+		for (uint16_t x = 0; x < w; x++)
+		{
+			*p++ = row[x * bytesPP + 2];
+			*p++ = row[x * bytesPP + 1];
+			*p++ = row[x * bytesPP];
+		}
+	}
+	return true;
+}
+
+int main(int argc, char* argv[])
+{
+	if (argc < 3)
+	{
+		std::cout << "Usage: " << argv[0] << " <output directory> <directory or .bmp file> ..." << std::endl;
+		return 1;
+	}
+	std::error_code ec;
+	fs::path outDir = argv[1];
+	fs::create_directories(outDir, ec);
+	if (!fs::is_directory(outDir, ec))
+	{
+		std::cout << "Error: could not create " << outDir << std::endl;
+		return 4;
+	}
+
+	// 1. Collect the BMP files
+	std::vector<fs::path> files;
+	for (int i = 2; i < argc; i++)
+	{
+		if (fs::is_directory(argv[i], ec))
+		{
+			for (const auto& item : fs::directory_iterator(argv[i], ec))
+			{
+				std::string ext = item.path().extension().string();
+				std::transform(ext.begin(), ext.end(), ext.begin(), ::tolower);
+				if (item.is_regular_file() && ext == ".bmp") files.push_back(item.path());
+			}
+		} else {
+			files.push_back(argv[i]);
+		}
+	}
+	std::sort(files.begin(), files.end());
+	if (files.empty())
+	{
+		std::cout << "Error: no BMP files found" << std::endl;
+		return 2;
+	}
+
+	// 2. Read each as RGB then encode
+	bmpReader bmp;
+	std::vector<uint8_t> rgb, encoded;
+	uint64_t totalBmp = 0, totalEncoded = 0;
+	for (const auto& file : files)
+	{
+		if (bmp.open(file.c_str()) != rvlDisplay_Success) return 3;
+		if (!ReadRGB(bmp, file, rgb))
+		{
+			std::cout << "Error: read failed " << file << std::endl;
+			return 3;
+		}
+		QOIEncode(rgb.data(), bmp.width(), bmp.height(), 3, encoded);
+
+		fs::path outPath = outDir / file.stem();
+		outPath += ".qoi";
+		std::ofstream out(outPath, std::ios::binary);
+		out.write((const char*)encoded.data(), encoded.size());
+		out.close();
+		if (!out)
+		{
+			std::cout << "Error: write failed " << outPath << std::endl;
+			return 4;
+		}
+		uint64_t bmpSize = fs::file_size(file, ec);
+		totalBmp += bmpSize;
+		totalEncoded += encoded.size();
+		std::cout << outPath.string() << " : " << bmp.width() << "x" << bmp.height() << " "
+			<< bmpSize << " -> " << encoded.size() << " bytes, "
+			<< (bmpSize ? (100 * encoded.size()) / bmpSize : 0) << "%" << std::endl;
+	}
+	std::cout << files.size() << " images, " << totalBmp << " -> " << totalEncoded << " bytes" << std::endl;
+	return 0;
+}
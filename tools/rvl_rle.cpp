@@ -0,0 +1,95 @@
+/*!
+	@file     tools/rvl_rle.cpp
+	@author   Gavin Lyons
+	@brief    Build time tool, encodes BMP files as RLE565 images. Project Name: ST7789_TFT_RPI
+	@details  Usage: rvl_rle <output directory> <directory or .bmp file> ...
+				Every .bmp file in each directory (not recursive) is encoded to
+				<output directory>/<name>.rle and the size saving printed.
+				Built by "make tools", runs on the host, does not need the bcm2835 library.
+	@note     Header fields are written in host order, build on a little endian host.
+*/
+
+#include <iostream>
+#include <fstream>
+#include <filesystem>
+#include <vector>
+#include <string>
+#include <algorithm>
+#include "bmp_file_RVL.hpp"
+#include "rle565_RVL.hpp"
+
+namespace fs = std::filesystem;
+
+int main(int argc, char* argv[])
+{
+	if (argc < 3)
+	{
+		std::cout << "Usage: " << argv[0] << " <output directory> <directory or .bmp file> ..." << std::endl;
+		return 1;
+	}
+	std::error_code ec;
+	fs::path outDir = argv[1];
+	fs::create_directories(outDir, ec);
+	if (!fs::is_directory(outDir, ec))
+	{
+		std::cout << "Error: could not create " << outDir << std::endl;
+		return 4;
+	}
+
+	// 1. Collect the BMP files
+	std::vector<fs::path> files;
+	for (int i = 2; i < argc; i++)
+	{
+		if (fs::is_directory(argv[i], ec))
+		{
+			for (const auto& item : fs::directory_iterator(argv[i], ec))
+			{
+				std::string ext = item.path().extension().string();
+				std::transform(ext.begin(), ext.end(), ext.begin(), ::tolower);
+				if (item.is_regular_file() && ext == ".bmp") files.push_back(item.path());
+			}
+		} else {
+			files.push_back(argv[i]);
+		}
+	}
+	std::sort(files.begin(), files.end());
+	if (files.empty())
+	{
+		std::cout << "Error: no BMP files found" << std::endl;
+		return 2;
+	}
+
+	// 2. Convert each to display format then encode
+	bmpReader bmp;
+	std::vector<uint8_t> pixels, encoded;
+	uint64_t totalRaw = 0, totalEncoded = 0;
+	for (const auto& file : files)
+	{
+		if (bmp.open(file.c_str()) != rvlDisplay_Success) return 3;
+		pixels.resize((size_t)bmp.width() * bmp.height() * 2);
+		for (uint16_t y = 0; y < bmp.height(); y++)
+		{
+			if (bmp.readRows(y, 1, 0, bmp.width(), pixels.data() + (size_t)y * bmp.width() * 2) != rvlDisplay_Success)
+				return 3;
+		}
+		RLE565Encode(pixels.data(), bmp.width(), bmp.height(), encoded);
+
+		fs::path outPath = outDir / file.stem();
+		outPath += ".rle";
+		std::ofstream out(outPath, std::ios::binary);
+		out.write((const char*)encoded.data(), encoded.size());
+		out.close();
+		if (!out)
+		{
+			std::cout << "Error: write failed " << outPath << std::endl;
+			return 4;
+		}
+		totalRaw += pixels.size();
+		totalEncoded += encoded.size();
+		std::cout << outPath.string() << " : " << bmp.width() << "x" << bmp.height() << " "
+			<< pixels.size() << " -> " << encoded.size() << " bytes, "
+			<< (100 * encoded.size()) / pixels.size() << "%" << std::endl;
+	}
+	std::cout << files.size() << " images, " << totalRaw << " -> " << totalEncoded << " bytes" << std::endl;
+	return 0;
+}